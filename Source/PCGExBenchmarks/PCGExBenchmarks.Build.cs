@@ -0,0 +1,39 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+using System;
+using System.IO;
+using UnrealBuildTool;
+
+public class PCGExBenchmarks : ModuleRules
+{
+	public PCGExBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		bool bNoPCH = Environment.GetEnvironmentVariable("PCGEX_NO_PCH") == "1" || File.Exists(Path.Combine(ModuleDirectory, "..", "..", "Config", ".noPCH"));
+		PCHUsage = bNoPCH ? PCHUsageMode.NoPCHs : PCHUsageMode.UseExplicitOrSharedPCHs;
+		bUseUnity = true;
+		MinSourceFilesForUnityBuildOverride = 4;
+		PrecompileForTargets = PrecompileTargetsType.Any;
+
+		PublicDependencyModuleNames.AddRange(
+			new[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"PCG",
+				"PCGExCore",
+				"PCGExCoreEditor",
+			}
+		);
+
+		// Element modules are intentionally not linked: benchmark cases resolve settings classes by path,
+		// so this module stays buildable and loadable whatever subset of the toolkit is enabled.
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Json",
+			}
+		);
+	}
+}
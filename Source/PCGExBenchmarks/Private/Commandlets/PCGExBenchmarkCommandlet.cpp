@@ -0,0 +1,74 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Commandlets/PCGExBenchmarkCommandlet.h"
+
+#include "PCGExBenchmarkSuite.h"
+#include "PCGExLog.h"
+#include "Misc/Paths.h"
+
+UPCGExBenchmarkCommandlet::UPCGExBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UPCGExBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PCGExBenchmarks;
+
+	const TArray<FBenchmarkCase>& Cases = GetBuiltinCases();
+
+	if (FParse::Param(*Params, TEXT("List")))
+	{
+		for (const FBenchmarkCase& Case : Cases) { UE_LOG(LogPCGEx, Display, TEXT("%-24s %s"), *Case.Name, *Case.Description); }
+		return 0;
+	}
+
+	FBenchmarkOptions Options;
+	Options.ParseParams(Params);
+
+	if (FParse::Param(*Params, TEXT("CountAllocs")) && !FAllocationCounter::Install())
+	{
+		UE_LOG(LogPCGEx, Warning, TEXT("Could not install allocation counter."));
+	}
+
+	TArray<FBenchmarkResult> Results;
+	RunCases(Cases, Options, Results);
+
+	if (Results.IsEmpty())
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("No benchmark matched filter '%s'."), *Options.Filter);
+		return 1;
+	}
+
+	LogResults(Results);
+
+	FString OutputPath;
+	if (FParse::Value(*Params, TEXT("Output="), OutputPath, false))
+	{
+		if (!WriteResultsJson(FPaths::ConvertRelativePathToFull(OutputPath), Results, Options))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("Could not write results to %s"), *OutputPath);
+			return 1;
+		}
+	}
+
+	FString CSVPath;
+	if (FParse::Value(*Params, TEXT("CSV="), CSVPath, false))
+	{
+		if (!WriteResultsCSV(FPaths::ConvertRelativePathToFull(CSVPath), Results))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("Could not write results to %s"), *CSVPath);
+			return 1;
+		}
+	}
+
+	int32 NumFailed = 0;
+	for (const FBenchmarkResult& Result : Results) { if (!Result.bSuccess) { NumFailed++; } }
+
+	return NumFailed ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Commandlets/PCGExBenchmarkGateCommandlet.h"
+
+#include "PCGExBenchmarkRegression.h"
+#include "PCGExLog.h"
+#include "Misc/Paths.h"
+
+UPCGExBenchmarkGateCommandlet::UPCGExBenchmarkGateCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UPCGExBenchmarkGateCommandlet::Main(const FString& Params)
+{
+	using namespace PCGExBenchmarks;
+
+	Regression::FManifest Manifest;
+
+	FString ManifestPath;
+	if (FParse::Value(*Params, TEXT("Manifest="), ManifestPath, false))
+	{
+		FString Error;
+		if (!Manifest.LoadFromFile(FPaths::ConvertRelativePathToFull(ManifestPath), Error))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("%s"), *Error);
+			return 1;
+		}
+	}
+
+	// Command-line options take precedence over the manifest
+	Manifest.Options.ParseParams(Params);
+
+	FString BaselinePath;
+	if (!FParse::Value(*Params, TEXT("Baseline="), BaselinePath, false))
+	{
+		BaselinePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("Baselines"), FPlatformProperties::IniPlatformName(), Manifest.Name + TEXT(".json"));
+	}
+	BaselinePath = FPaths::ConvertRelativePathToFull(BaselinePath);
+
+	TMap<FString, FString> Metadata;
+	Metadata.Add(TEXT("Manifest"), Manifest.Name);
+
+	FString Revision;
+	if (FParse::Value(*Params, TEXT("Revision="), Revision, false)) { Metadata.Add(TEXT("Revision"), Revision); }
+
+	if (FParse::Param(*Params, TEXT("CountAllocs"))) { FAllocationCounter::Install(); }
+
+	TArray<FBenchmarkCase> Cases;
+	Manifest.GetCases(Cases);
+
+	TArray<FBenchmarkResult> Results;
+	RunCases(Cases, Manifest.Options, Results);
+
+	if (Results.IsEmpty())
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("Manifest '%s' did not run any benchmark."), *Manifest.Name);
+		return 1;
+	}
+
+	const bool bUpdateBaseline = FParse::Param(*Params, TEXT("UpdateBaseline"));
+	const bool bHasBaseline = FPaths::FileExists(BaselinePath);
+
+	if (bUpdateBaseline || !bHasBaseline)
+	{
+		LogResults(Results);
+
+		if (!WriteResultsJson(BaselinePath, Results, Manifest.Options, Metadata))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("Could not write baseline %s"), *BaselinePath);
+			return 1;
+		}
+
+		UE_LOG(LogPCGEx, Display, TEXT("Baseline %s : %s"), bHasBaseline ? TEXT("updated") : TEXT("created"), *BaselinePath);
+
+		int32 NumFailed = 0;
+		for (const FBenchmarkResult& Result : Results) { if (!Result.bSuccess) { NumFailed++; } }
+		return NumFailed ? 1 : 0;
+	}
+
+	TArray<FBenchmarkResult> Baseline;
+	TMap<FString, FString> BaselineMetadata;
+	if (!ReadResultsJson(BaselinePath, Baseline, &BaselineMetadata))
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("Could not read baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	if (const FString* BaselineRevision = BaselineMetadata.Find(TEXT("Revision")))
+	{
+		UE_LOG(LogPCGEx, Display, TEXT("Comparing against baseline revision %s (%s)"), **BaselineRevision, *BaselineMetadata.FindRef(TEXT("CreatedAt")));
+	}
+
+	TArray<Regression::FComparison> Comparisons;
+	Regression::CompareAll(Baseline, Results, Manifest, Comparisons);
+
+	const int32 NumFailures = Regression::LogReport(Comparisons);
+
+	FString ReportPath;
+	if (FParse::Value(*Params, TEXT("Report="), ReportPath, false))
+	{
+		if (!Regression::WriteReportJson(FPaths::ConvertRelativePathToFull(ReportPath), Comparisons, Metadata))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("Could not write report %s"), *ReportPath);
+		}
+	}
+
+	return NumFailures ? 1 : 0;
+}
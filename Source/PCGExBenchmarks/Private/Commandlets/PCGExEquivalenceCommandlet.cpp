@@ -0,0 +1,111 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Commandlets/PCGExEquivalenceCommandlet.h"
+
+#include "PCGExBenchmarkSuite.h"
+#include "PCGExExecutionModes.h"
+#include "PCGExLog.h"
+#include "Data/Utils/PCGExDataFingerprint.h"
+
+UPCGExEquivalenceCommandlet::UPCGExEquivalenceCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UPCGExEquivalenceCommandlet::Main(const FString& Params)
+{
+	using namespace PCGExBenchmarks;
+
+	FBenchmarkOptions Options;
+	Options.Tiers = {1000, 10000};
+	Options.ParseParams(Params);
+
+	FString ModeNames;
+	FParse::Value(*Params, TEXT("Modes="), ModeNames, false);
+
+	TArray<ExecutionModes::FExecutionMode> Modes;
+	ExecutionModes::GetModes(ModeNames, Modes);
+
+	PCGExFingerprint::FOptions FingerprintOptions;
+	FingerprintOptions.bOrderIndependent = !FParse::Param(*Params, TEXT("Ordered"));
+	FParse::Value(*Params, TEXT("Tolerance="), FingerprintOptions.Tolerance);
+
+	int32 MaxDiffs = 10;
+	FParse::Value(*Params, TEXT("MaxDiffs="), MaxDiffs);
+
+	int32 NumCases = 0;
+	int32 NumFailed = 0;
+
+	for (const FBenchmarkCase& Case : GetBuiltinCases())
+	{
+		if (!Options.PassesFilter(Case.Name)) { continue; }
+
+		for (const int32 Size : Options.Tiers)
+		{
+			NumCases++;
+
+			const FString Key = FString::Printf(TEXT("%s@%d"), *Case.Name, Size);
+			PCGExFingerprint::FFingerprint Reference;
+			bool bCaseFailed = false;
+
+			for (int i = 0; i < Modes.Num(); i++)
+			{
+				PCGExFingerprint::FFingerprint Fingerprint;
+				FString Error;
+
+				bool bSuccess = false;
+				{
+					ExecutionModes::FScopedMode Scope(Modes[i]);
+					bSuccess = ExecuteCase(
+						Case, Size, Options, [&](const FPCGDataCollection& InOutputs)
+						{
+							Fingerprint = PCGExFingerprint::Compute(InOutputs, FingerprintOptions);
+						}, Error);
+				}
+
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+				if (!bSuccess)
+				{
+					UE_LOG(LogPCGEx, Error, TEXT("%-32s %-16s FAILED : %s"), *Key, *Modes[i].Name, *Error);
+					bCaseFailed = true;
+					break;
+				}
+
+				if (i == 0)
+				{
+					Reference = MoveTemp(Fingerprint);
+					continue;
+				}
+
+				TArray<FString> Differences;
+				if (PCGExFingerprint::Diff(Reference, Fingerprint, Differences))
+				{
+					UE_LOG(LogPCGEx, Verbose, TEXT("%-32s %-16s OK"), *Key, *Modes[i].Name);
+					continue;
+				}
+
+				bCaseFailed = true;
+				UE_LOG(LogPCGEx, Error, TEXT("%-32s %-16s DIVERGES from %s (%d differences)"), *Key, *Modes[i].Name, *Modes[0].Name, Differences.Num());
+				for (int d = 0; d < FMath::Min(MaxDiffs, Differences.Num()); d++) { UE_LOG(LogPCGEx, Error, TEXT("    %s"), *Differences[d]); }
+			}
+
+			if (bCaseFailed) { NumFailed++; }
+			else { UE_LOG(LogPCGEx, Display, TEXT("%-32s equivalent across %d modes [%016llx]"), *Key, Modes.Num(), Reference.Hash); }
+		}
+	}
+
+	if (!NumCases)
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("No benchmark matched filter '%s'."), *Options.Filter);
+		return 1;
+	}
+
+	UE_LOG(LogPCGEx, Display, TEXT("Equivalence: %d/%d cases passed."), NumCases - NumFailed, NumCases);
+	return NumFailed ? 1 : 0;
+}
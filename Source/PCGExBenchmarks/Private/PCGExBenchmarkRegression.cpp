@@ -0,0 +1,368 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBenchmarkRegression.h"
+
+#include <cmath>
+
+#include "PCGExLog.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PCGExBenchmarks::Regression
+{
+	namespace
+	{
+		double Median(TArray<double> Values)
+		{
+			if (Values.IsEmpty()) { return 0; }
+			Values.Sort();
+			const int32 Mid = Values.Num() / 2;
+			return Values.Num() % 2 ? Values[Mid] : (Values[Mid - 1] + Values[Mid]) * 0.5;
+		}
+
+		void ReadOptions(const TSharedPtr<FJsonObject>& InObject, FBenchmarkOptions& OutOptions)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tiers = nullptr;
+			if (InObject->TryGetArrayField(TEXT("Tiers"), Tiers))
+			{
+				OutOptions.Tiers.Reset();
+				for (const TSharedPtr<FJsonValue>& Tier : *Tiers) { if (const int32 Size = static_cast<int32>(Tier->AsNumber()); Size > 0) { OutOptions.Tiers.Add(Size); } }
+			}
+
+			InObject->TryGetNumberField(TEXT("Iterations"), OutOptions.Iterations);
+			InObject->TryGetNumberField(TEXT("Warmup"), OutOptions.WarmupIterations);
+			InObject->TryGetNumberField(TEXT("Seed"), OutOptions.Seed);
+			InObject->TryGetNumberField(TEXT("Timeout"), OutOptions.Timeout);
+			InObject->TryGetBoolField(TEXT("RecordPhases"), OutOptions.bRecordPhases);
+		}
+	}
+
+	void FThresholds::FromJson(const TSharedPtr<FJsonObject>& InObject)
+	{
+		if (!InObject.IsValid()) { return; }
+
+		InObject->TryGetNumberField(TEXT("Relative"), RelativeTolerance);
+		InObject->TryGetNumberField(TEXT("NoiseSigmas"), NoiseSigmas);
+		InObject->TryGetNumberField(TEXT("Significance"), Significance);
+		InObject->TryGetNumberField(TEXT("MinSamplesForTest"), MinSamplesForTest);
+
+		double MinAbsoluteMs = 0;
+		if (InObject->TryGetNumberField(TEXT("MinAbsoluteMs"), MinAbsoluteMs)) { MinAbsoluteSeconds = MinAbsoluteMs * 0.001; }
+	}
+
+	FManifest::FManifest()
+	{
+		// Gate runs favor more samples over large tiers
+		Options.Iterations = 7;
+		Options.WarmupIterations = 1;
+		Options.bRecordPhases = true;
+	}
+
+	bool FManifest::LoadFromFile(const FString& InFilePath, FString& OutError)
+	{
+		FString Input;
+		if (!FFileHelper::LoadFileToString(Input, *InFilePath))
+		{
+			OutError = FString::Printf(TEXT("Cannot read manifest %s"), *InFilePath);
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Input), Root) || !Root.IsValid())
+		{
+			OutError = FString::Printf(TEXT("Manifest %s is not valid JSON"), *InFilePath);
+			return false;
+		}
+
+		Root->TryGetStringField(TEXT("Name"), Name);
+		Root->TryGetStringArrayField(TEXT("Cases"), Cases);
+		ReadOptions(Root, Options);
+
+		const TSharedPtr<FJsonObject>* JsonThresholds = nullptr;
+		if (Root->TryGetObjectField(TEXT("Thresholds"), JsonThresholds)) { Thresholds.FromJson(*JsonThresholds); }
+
+		const TSharedPtr<FJsonObject>* JsonCaseThresholds = nullptr;
+		if (Root->TryGetObjectField(TEXT("CaseThresholds"), JsonCaseThresholds))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*JsonCaseThresholds)->Values)
+			{
+				// Per-case entries only override what they specify
+				FThresholds& CaseThreshold = CaseThresholds.Add(Entry.Key, Thresholds);
+				CaseThreshold.FromJson(Entry.Value->AsObject());
+			}
+		}
+
+		// Duplicates are harmless, unknown names are not
+		TSet<FString> KnownCases;
+		for (const FBenchmarkCase& Case : GetBuiltinCases()) { KnownCases.Add(Case.Name); }
+
+		TArray<FString> UnknownCases;
+		for (const FString& CaseName : TSet<FString>(Cases))
+		{
+			if (!KnownCases.Contains(CaseName)) { UnknownCases.Add(CaseName); }
+		}
+
+		if (!UnknownCases.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("Manifest %s references unknown cases: %s"), *InFilePath, *FString::Join(UnknownCases, TEXT(", ")));
+			return false;
+		}
+
+		return true;
+	}
+
+	const FThresholds& FManifest::GetThresholds(const FString& InCaseName) const
+	{
+		const FThresholds* CaseThreshold = CaseThresholds.Find(InCaseName);
+		return CaseThreshold ? *CaseThreshold : Thresholds;
+	}
+
+	void FManifest::GetCases(TArray<FBenchmarkCase>& OutCases) const
+	{
+		for (const FBenchmarkCase& Case : GetBuiltinCases())
+		{
+			if (!Cases.IsEmpty() && !Cases.Contains(Case.Name)) { continue; }
+			if (!Options.PassesFilter(Case.Name)) { continue; }
+			OutCases.Add(Case);
+		}
+	}
+
+	const TCHAR* LexToString(const EVerdict InVerdict)
+	{
+		switch (InVerdict)
+		{
+		case EVerdict::Unchanged: return TEXT("OK");
+		case EVerdict::Improved: return TEXT("IMPROVED");
+		case EVerdict::Regressed: return TEXT("REGRESSED");
+		case EVerdict::Failed: return TEXT("FAILED");
+		case EVerdict::NoBaseline: return TEXT("NEW");
+		default: return TEXT("?");
+		}
+	}
+
+	FString FComparison::ToString(const int32 MaxPhases) const
+	{
+		if (Verdict == EVerdict::Failed) { return FString::Printf(TEXT("%-10s %-32s %s"), LexToString(Verdict), *Key, *Error); }
+		if (Verdict == EVerdict::NoBaseline) { return FString::Printf(TEXT("%-10s %-32s %10.3fms"), LexToString(Verdict), *Key, CurrentMedian * 1000); }
+
+		FString Line = FString::Printf(
+			TEXT("%-10s %-32s %10.3fms -> %10.3fms (%+6.1f%%, threshold %.3fms, p=%.3f)"),
+			LexToString(Verdict), *Key, BaselineMedian * 1000, CurrentMedian * 1000, GetRelativeDelta() * 100, Threshold * 1000, PValue);
+
+		if (Verdict != EVerdict::Unchanged && !Phases.IsEmpty())
+		{
+			Line += TEXT(" | ");
+			for (int i = 0; i < FMath::Min(MaxPhases, Phases.Num()); i++)
+			{
+				const FPhaseDelta& Phase = Phases[i];
+				Line += FString::Printf(TEXT("%s%s %+.3fms"), i ? TEXT(", ") : TEXT(""), *Phase.Name, (Phase.Current - Phase.Baseline) * 1000);
+			}
+		}
+
+		return Line;
+	}
+
+	TSharedRef<FJsonObject> FComparison::ToJson() const
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Key"), Key);
+		Object->SetStringField(TEXT("Verdict"), LexToString(Verdict));
+		Object->SetNumberField(TEXT("BaselineMedian"), BaselineMedian);
+		Object->SetNumberField(TEXT("CurrentMedian"), CurrentMedian);
+		Object->SetNumberField(TEXT("RelativeDelta"), GetRelativeDelta());
+		Object->SetNumberField(TEXT("Threshold"), Threshold);
+		Object->SetNumberField(TEXT("PValue"), PValue);
+		if (!Error.IsEmpty()) { Object->SetStringField(TEXT("Error"), Error); }
+
+		TArray<TSharedPtr<FJsonValue>> JsonPhases;
+		for (const FPhaseDelta& Phase : Phases)
+		{
+			TSharedRef<FJsonObject> JsonPhase = MakeShared<FJsonObject>();
+			JsonPhase->SetStringField(TEXT("Name"), Phase.Name);
+			JsonPhase->SetNumberField(TEXT("Baseline"), Phase.Baseline);
+			JsonPhase->SetNumberField(TEXT("Current"), Phase.Current);
+			JsonPhases.Add(MakeShared<FJsonValueObject>(JsonPhase));
+		}
+		if (!JsonPhases.IsEmpty()) { Object->SetArrayField(TEXT("Phases"), JsonPhases); }
+
+		return Object;
+	}
+
+	double RobustSigma(const TArray<double>& InSamples)
+	{
+		if (InSamples.Num() < 2) { return 0; }
+
+		const double Center = Median(InSamples);
+
+		TArray<double> Deviations;
+		Deviations.Reserve(InSamples.Num());
+		for (const double Sample : InSamples) { Deviations.Add(FMath::Abs(Sample - Center)); }
+
+		return 1.4826 * Median(MoveTemp(Deviations));
+	}
+
+	double MannWhitneyPValue(const TArray<double>& A, const TArray<double>& B)
+	{
+		const int32 NA = A.Num();
+		const int32 NB = B.Num();
+		const int32 N = NA + NB;
+		if (!NA || !NB) { return 1; }
+
+		TArray<TPair<double, int8>> Pooled;
+		Pooled.Reserve(N);
+		for (const double Value : A) { Pooled.Emplace(Value, 0); }
+		for (const double Value : B) { Pooled.Emplace(Value, 1); }
+		Pooled.Sort([](const TPair<double, int8>& L, const TPair<double, int8>& R) { return L.Key < R.Key; });
+
+		// Average ranks over ties, accumulating the tie correction term
+		double RankSumA = 0;
+		double TieTerm = 0;
+		for (int i = 0; i < N;)
+		{
+			int j = i;
+			while (j + 1 < N && Pooled[j + 1].Key == Pooled[i].Key) { j++; }
+
+			const double Rank = (i + j) * 0.5 + 1;
+			for (int k = i; k <= j; k++) { if (Pooled[k].Value == 0) { RankSumA += Rank; } }
+
+			const double T = j - i + 1;
+			TieTerm += T * T * T - T;
+			i = j + 1;
+		}
+
+		const double U = RankSumA - NA * (NA + 1) * 0.5;
+		const double Mu = NA * NB * 0.5;
+		const double Variance = (NA * NB / 12.0) * ((N + 1) - TieTerm / (static_cast<double>(N) * (N - 1)));
+		if (Variance <= 0) { return 1; }
+
+		const double Z = FMath::Max(0.0, FMath::Abs(U - Mu) - 0.5) / FMath::Sqrt(Variance);
+		return std::erfc(Z / UE_SQRT_2);
+	}
+
+	FComparison Compare(const FBenchmarkResult& InBaseline, const FBenchmarkResult& InCurrent, const FThresholds& InThresholds)
+	{
+		FComparison Comparison;
+		Comparison.Key = InCurrent.GetKey();
+		Comparison.BaselineMedian = InBaseline.Median;
+		Comparison.CurrentMedian = InCurrent.Median;
+
+		if (!InCurrent.bSuccess)
+		{
+			Comparison.Verdict = EVerdict::Failed;
+			Comparison.Error = InCurrent.Error;
+			return Comparison;
+		}
+
+		if (!InBaseline.bSuccess || InBaseline.Samples.IsEmpty())
+		{
+			Comparison.Verdict = EVerdict::NoBaseline;
+			return Comparison;
+		}
+
+		const double PooledSigma = FMath::Sqrt(FMath::Square(RobustSigma(InBaseline.Samples)) + FMath::Square(RobustSigma(InCurrent.Samples)));
+		Comparison.Threshold = FMath::Max3(
+			InThresholds.RelativeTolerance * InBaseline.Median,
+			InThresholds.NoiseSigmas * PooledSigma,
+			InThresholds.MinAbsoluteSeconds);
+
+		const bool bCanTest = InBaseline.Samples.Num() >= InThresholds.MinSamplesForTest && InCurrent.Samples.Num() >= InThresholds.MinSamplesForTest;
+		if (bCanTest) { Comparison.PValue = MannWhitneyPValue(InBaseline.Samples, InCurrent.Samples); }
+
+		const bool bSignificant = !bCanTest || Comparison.PValue < InThresholds.Significance;
+		const double Delta = Comparison.GetDelta();
+
+		if (bSignificant && Delta > Comparison.Threshold) { Comparison.Verdict = EVerdict::Regressed; }
+		else if (bSignificant && -Delta > Comparison.Threshold) { Comparison.Verdict = EVerdict::Improved; }
+
+		TSet<FString> PhaseNames;
+		for (const TPair<FString, double>& Phase : InBaseline.Phases) { PhaseNames.Add(Phase.Key); }
+		for (const TPair<FString, double>& Phase : InCurrent.Phases) { PhaseNames.Add(Phase.Key); }
+
+		for (const FString& PhaseName : PhaseNames)
+		{
+			FPhaseDelta& Phase = Comparison.Phases.Emplace_GetRef();
+			Phase.Name = PhaseName;
+			Phase.Baseline = InBaseline.Phases.FindRef(PhaseName);
+			Phase.Current = InCurrent.Phases.FindRef(PhaseName);
+		}
+
+		Comparison.Phases.Sort([](const FPhaseDelta& L, const FPhaseDelta& R) { return FMath::Abs(L.Current - L.Baseline) > FMath::Abs(R.Current - R.Baseline); });
+
+		return Comparison;
+	}
+
+	void CompareAll(const TArray<FBenchmarkResult>& InBaseline, const TArray<FBenchmarkResult>& InCurrent, const FManifest& InManifest, TArray<FComparison>& OutComparisons)
+	{
+		TMap<FString, const FBenchmarkResult*> BaselineMap;
+		for (const FBenchmarkResult& Result : InBaseline) { BaselineMap.Add(Result.GetKey(), &Result); }
+
+		const FBenchmarkResult Missing;
+		OutComparisons.Reserve(OutComparisons.Num() + InCurrent.Num());
+
+		for (const FBenchmarkResult& Current : InCurrent)
+		{
+			const FBenchmarkResult* const* Baseline = BaselineMap.Find(Current.GetKey());
+			OutComparisons.Add(Compare(Baseline ? **Baseline : Missing, Current, InManifest.GetThresholds(Current.Name)));
+		}
+	}
+
+	int32 LogReport(const TArray<FComparison>& InComparisons)
+	{
+		int32 NumFailures = 0;
+		int32 NumImproved = 0;
+		int32 NumNew = 0;
+
+		for (const FComparison& Comparison : InComparisons)
+		{
+			switch (Comparison.Verdict)
+			{
+			case EVerdict::Regressed:
+			case EVerdict::Failed:
+				NumFailures++;
+				UE_LOG(LogPCGEx, Error, TEXT("%s"), *Comparison.ToString());
+				break;
+			case EVerdict::Improved:
+				NumImproved++;
+				UE_LOG(LogPCGEx, Display, TEXT("%s"), *Comparison.ToString());
+				break;
+			case EVerdict::NoBaseline:
+				NumNew++;
+				UE_LOG(LogPCGEx, Warning, TEXT("%s"), *Comparison.ToString());
+				break;
+			default:
+				UE_LOG(LogPCGEx, Display, TEXT("%s"), *Comparison.ToString());
+				break;
+			}
+		}
+
+		UE_LOG(
+			LogPCGEx, Display, TEXT("Benchmark gate: %d compared, %d regressed/failed, %d improved, %d without baseline."),
+			InComparisons.Num(), NumFailures, NumImproved, NumNew);
+
+		return NumFailures;
+	}
+
+	bool WriteReportJson(const FString& InFilePath, const TArray<FComparison>& InComparisons, const TMap<FString, FString>& InMetadata)
+	{
+		const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("Version"), ResultsVersion);
+
+		const TSharedRef<FJsonObject> JsonMetadata = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Entry : InMetadata) { JsonMetadata->SetStringField(Entry.Key, Entry.Value); }
+		Root->SetObjectField(TEXT("Metadata"), JsonMetadata);
+
+		TArray<TSharedPtr<FJsonValue>> JsonComparisons;
+		for (const FComparison& Comparison : InComparisons) { JsonComparisons.Add(MakeShared<FJsonValueObject>(Comparison.ToJson())); }
+		Root->SetArrayField(TEXT("Comparisons"), JsonComparisons);
+
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		if (!FJsonSerializer::Serialize(Root, Writer)) { return false; }
+
+		return FFileHelper::SaveStringToFile(Output, *InFilePath);
+	}
+}
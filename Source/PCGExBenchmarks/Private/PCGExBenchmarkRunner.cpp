@@ -0,0 +1,259 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBenchmarkRunner.h"
+
+#include <atomic>
+
+#include "PCGContext.h"
+#include "PCGElement.h"
+#include "PCGSettings.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Core/PCGExMTMainThread.h"
+#include "Data/PCGBasePointData.h"
+#include "HAL/MemoryBase.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace PCGExBenchmarks
+{
+	namespace
+	{
+		std::atomic<int64> GNumAllocations{0};
+		std::atomic<int64> GAllocatedBytes{0};
+		std::atomic<bool> GCounterInstalled{false};
+
+		class FCountingMalloc final : public FMalloc
+		{
+			FMalloc* Inner = nullptr;
+
+			static void Count(const SIZE_T Size)
+			{
+				GNumAllocations.fetch_add(1, std::memory_order_relaxed);
+				GAllocatedBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed);
+			}
+
+		public:
+			explicit FCountingMalloc(FMalloc* InInner)
+				: Inner(InInner)
+			{
+			}
+
+			virtual void* Malloc(const SIZE_T Count, const uint32 Alignment) override
+			{
+				FCountingMalloc::Count(Count);
+				return Inner->Malloc(Count, Alignment);
+			}
+
+			virtual void* TryMalloc(const SIZE_T Count, const uint32 Alignment) override
+			{
+				FCountingMalloc::Count(Count);
+				return Inner->TryMalloc(Count, Alignment);
+			}
+
+			virtual void* Realloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+			{
+				FCountingMalloc::Count(Count);
+				return Inner->Realloc(Original, Count, Alignment);
+			}
+
+			virtual void* TryRealloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+			{
+				FCountingMalloc::Count(Count);
+				return Inner->TryRealloc(Original, Count, Alignment);
+			}
+
+			virtual void Free(void* Original) override { Inner->Free(Original); }
+			virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+			virtual SIZE_T QuantizeSize(const SIZE_T Count, const uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+			virtual void Trim(const bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+			virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+			virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+			virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+			virtual void UpdateStats() override { Inner->UpdateStats(); }
+			virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+			virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+			virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+			virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+			virtual const TCHAR* GetDescriptiveName() override { return TEXT("PCGExCountingMalloc"); }
+		};
+	}
+
+	bool FAllocationCounter::Install()
+	{
+		check(IsInGameThread())
+
+		if (GCounterInstalled.load()) { return true; }
+		if (!GMalloc) { return false; }
+
+		// Must happen before any worker is busy; the commandlet installs it before running the first case.
+		GMalloc = new FCountingMalloc(GMalloc);
+		GCounterInstalled.store(true);
+		return true;
+	}
+
+	bool FAllocationCounter::IsInstalled() { return GCounterInstalled.load(); }
+	int64 FAllocationCounter::GetNumAllocations() { return GNumAllocations.load(std::memory_order_relaxed); }
+	int64 FAllocationCounter::GetAllocatedBytes() { return GAllocatedBytes.load(std::memory_order_relaxed); }
+
+	UPCGSettings* FRunner::CreateSettings(UObject* Outer, const FElementStep& InStep, FString& OutError) const
+	{
+		UClass* SettingsClass = FSoftClassPath(InStep.SettingsClass).TryLoadClass<UPCGSettings>();
+		if (!SettingsClass || !SettingsClass->IsChildOf(UPCGSettings::StaticClass()))
+		{
+			OutError = FString::Printf(TEXT("Unknown settings class '%s'"), *InStep.SettingsClass);
+			return nullptr;
+		}
+
+		UPCGSettings* Settings = NewObject<UPCGSettings>(Outer ? Outer : GetTransientPackage(), SettingsClass, NAME_None, RF_Transient);
+
+		for (const TPair<FName, FString>& Instanced : InStep.InstancedObjects)
+		{
+			const FObjectPropertyBase* Property = CastField<FObjectPropertyBase>(SettingsClass->FindPropertyByName(Instanced.Key));
+			UClass* ObjectClass = FSoftClassPath(Instanced.Value).TryLoadClass<UObject>();
+
+			if (!Property || !ObjectClass || !ObjectClass->IsChildOf(Property->PropertyClass))
+			{
+				OutError = FString::Printf(TEXT("Cannot instance '%s' into %s::%s"), *Instanced.Value, *SettingsClass->GetName(), *Instanced.Key.ToString());
+				return nullptr;
+			}
+
+			UObject* Object = NewObject<UObject>(Settings, ObjectClass, Instanced.Key, RF_Transient);
+			Property->SetObjectPropertyValue_InContainer(Settings, Object);
+		}
+
+		for (const TPair<FName, FString>& Override : InStep.Properties)
+		{
+			const FProperty* Property = SettingsClass->FindPropertyByName(Override.Key);
+			if (!Property)
+			{
+				OutError = FString::Printf(TEXT("Unknown property %s::%s"), *SettingsClass->GetName(), *Override.Key.ToString());
+				return nullptr;
+			}
+
+			if (!Property->ImportText_InContainer(*Override.Value, Settings, Settings, PPF_None))
+			{
+				OutError = FString::Printf(TEXT("Could not import '%s' into %s::%s"), *Override.Value, *SettingsClass->GetName(), *Override.Key.ToString());
+				return nullptr;
+			}
+		}
+
+		return Settings;
+	}
+
+	FStepResult FRunner::Execute(UPCGSettings* InSettings, const FPCGDataCollection& InData, FPCGDataCollection& OutData, const FElementStep* InStep) const
+	{
+		check(IsInGameThread())
+
+		FStepResult Result;
+
+		if (!InSettings)
+		{
+			Result.Error = TEXT("Invalid settings");
+			return Result;
+		}
+
+		const FPCGElementPtr Element = InSettings->GetElement();
+		if (!Element)
+		{
+			Result.Error = FString::Printf(TEXT("%s has no element"), *InSettings->GetClass()->GetName());
+			return Result;
+		}
+
+		// No node and no execution source: the element resolves its settings from the input collection
+		FPCGDataCollection InputData = InData;
+		InputData.TaggedData.Emplace_GetRef().Data = InSettings;
+
+		const FPCGInitializeElementParams Params(&InputData, TWeakInterfacePtr<IPCGGraphExecutionSource>(), nullptr);
+		FPCGContext* Context = Element->Initialize(Params);
+		if (!Context)
+		{
+			Result.Error = TEXT("Element failed to initialize a context");
+			return Result;
+		}
+
+		Context->InitializeSettings();
+		Context->AsyncState.NumAvailableTasks = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		Context->AsyncState.bIsRunningOnMainThread = true;
+
+		const int64 AllocationsBefore = FAllocationCounter::GetNumAllocations();
+		const int64 BytesBefore = FAllocationCounter::GetAllocatedBytes();
+
+		const double StartTime = FPlatformTime::Seconds();
+		bool bDone = false;
+		bool bTimedOut = false;
+
+		while (!bDone)
+		{
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(PCGExBenchmarks::Execute);
+				bDone = Element->Execute(Context);
+			}
+
+			if (bDone) { break; }
+
+			if (FPlatformTime::Seconds() - StartTime > Timeout)
+			{
+				bTimedOut = true;
+				Element->Abort(Context);
+				break;
+			}
+
+			// Async work may hop back to the game thread (ExecuteOnMainThread); nothing else pumps it in a commandlet,
+			// and the coalesced main-thread queue relies on the core ticker which doesn't tick here either
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			PCGExMT::MainThread::Flush();
+			if (Context->bIsPaused) { FPlatformProcess::SleepNoStats(0); }
+		}
+
+		// Don't leak callbacks queued by this run (e.g. after a timeout) into the next one
+		PCGExMT::MainThread::Flush();
+
+		Result.Seconds = FPlatformTime::Seconds() - StartTime;
+		Result.NumAllocations = FAllocationCounter::GetNumAllocations() - AllocationsBefore;
+		Result.AllocatedBytes = FAllocationCounter::GetAllocatedBytes() - BytesBefore;
+
+		if (bTimedOut)
+		{
+			Result.Error = FString::Printf(TEXT("Timed out after %.1fs"), Timeout);
+		}
+		else if (Context->OutputData.bCancelExecution)
+		{
+			Result.Error = TEXT("Execution was cancelled");
+		}
+		else
+		{
+			Result.bSuccess = true;
+		}
+
+		for (const FPCGTaggedData& TaggedData : Context->OutputData.TaggedData)
+		{
+			FPCGTaggedData& Output = OutData.TaggedData.Add_GetRef(TaggedData);
+			if (const FName* Remapped = InStep ? InStep->OutputPinRemap.Find(Output.Pin) : nullptr) { Output.Pin = *Remapped; }
+		}
+
+		Result.NumOutputData = Context->OutputData.TaggedData.Num();
+		Result.NumOutputPoints = CountPoints(Context->OutputData);
+
+		FPCGContext::Release(Context);
+
+		return Result;
+	}
+
+	FStepResult FRunner::Run(UObject* Outer, const FElementStep& InStep, const FPCGDataCollection& InData, FPCGDataCollection& OutData) const
+	{
+		FStepResult Result;
+		UPCGSettings* Settings = CreateSettings(Outer, InStep, Result.Error);
+		if (!Settings) { return Result; }
+		return Execute(Settings, InData, OutData, &InStep);
+	}
+
+	int64 FRunner::CountPoints(const FPCGDataCollection& InData)
+	{
+		int64 NumPoints = 0;
+		for (const FPCGTaggedData& TaggedData : InData.TaggedData)
+		{
+			if (const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(TaggedData.Data)) { NumPoints += PointData->GetNumPoints(); }
+		}
+		return NumPoints;
+	}
+}
@@ -0,0 +1,578 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBenchmarkSuite.h"
+
+#include "PCGCommon.h"
+#include "PCGExLog.h"
+#include "PCGExSyntheticData.h"
+#include "Core/PCGExMTTelemetry.h"
+#include "Data/PCGBasePointData.h"
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PCGExBenchmarks
+{
+	namespace
+	{
+		const FName InLabel = PCGPinConstants::DefaultInputLabel;
+		const FName PathsLabel = FName("Paths");
+		const FName TargetsLabel = FName("Targets");
+		const FName SeedsLabel = FName("Seeds");
+		const FName GoalsLabel = FName("Goals");
+
+		const FBox DefaultBounds = FBox(FVector(-10000, -10000, -1000), FVector(10000, 10000, 1000));
+
+		void AddInput(FPCGDataCollection& OutInputs, const FName Pin, const UPCGData* InData)
+		{
+			FPCGTaggedData& TaggedData = OutInputs.TaggedData.Emplace_GetRef();
+			TaggedData.Data = InData;
+			TaggedData.Pin = Pin;
+		}
+
+		/** Nothing pumps GC in a commandlet, but a case must survive an explicit CollectGarbage between cases. */
+		class FRootScope
+		{
+			TArray<UObject*> Rooted;
+
+		public:
+			void Add(const FPCGDataCollection& InData)
+			{
+				for (const FPCGTaggedData& TaggedData : InData.TaggedData)
+				{
+					UObject* Object = const_cast<UPCGData*>(TaggedData.Data.Get());
+					if (!Object || Object->IsRooted()) { continue; }
+					Object->AddToRoot();
+					Rooted.Add(Object);
+				}
+			}
+
+			~FRootScope()
+			{
+				for (UObject* Object : Rooted) { Object->RemoveFromRoot(); }
+			}
+		};
+
+		double ComputeMedian(TArray<double> Values)
+		{
+			if (Values.IsEmpty()) { return 0; }
+			Values.Sort();
+			const int32 Mid = Values.Num() / 2;
+			return Values.Num() % 2 ? Values[Mid] : (Values[Mid - 1] + Values[Mid]) * 0.5;
+		}
+
+		int64 ComputeMedian(TArray<int64> Values)
+		{
+			if (Values.IsEmpty()) { return 0; }
+			Values.Sort();
+			return Values[Values.Num() / 2];
+		}
+
+		/** Synthetic inputs + setup steps outputs, all rooted in InRoots. */
+		bool PrepareInputs(const FBenchmarkCase& InCase, const int32 InSize, const FBenchmarkOptions& InOptions, const FRunner& InRunner, UObject* Outer, FRootScope& InRoots, FPCGDataCollection& OutInputs, FString& OutError)
+		{
+			if (InCase.MakeInputs) { InCase.MakeInputs(Outer, InSize, InOptions.Seed, OutInputs); }
+			InRoots.Add(OutInputs);
+
+			for (const FElementStep& Step : InCase.Setup)
+			{
+				FPCGDataCollection SetupOutputs;
+				const FStepResult SetupResult = InRunner.Run(Outer, Step, OutInputs, SetupOutputs);
+				if (!SetupResult.bSuccess)
+				{
+					OutError = FString::Printf(TEXT("Setup '%s' failed: %s"), *Step.SettingsClass, *SetupResult.Error);
+					return false;
+				}
+
+				InRoots.Add(SetupOutputs);
+				OutInputs.TaggedData.Append(SetupOutputs.TaggedData);
+			}
+
+			return true;
+		}
+
+		TArray<FBenchmarkCase> MakeBuiltinCases()
+		{
+			TArray<FBenchmarkCase> Cases;
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("FusePoints");
+				Case.Description = TEXT("Fuse clustered points");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					AddInput(OutInputs, InLabel, SyntheticData::MakeClusteredPoints(Outer, Size, FMath::Max(1, Size / 50), 200, DefaultBounds, Seed));
+				};
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsSpatial.PCGExFusePointsSettings"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("SortPoints");
+				Case.Description = TEXT("Sort points on a double attribute");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					UPCGBasePointData* Points = SyntheticData::MakeUniformPoints(Outer, Size, DefaultBounds, Seed);
+					SyntheticData::AddDoubleColumn(Points, FName("Score"), 0, 1, Seed);
+					AddInput(OutInputs, InLabel, Points);
+				};
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsMeta.PCGExSortPointsSettings"))
+					.Set(FName("Rules"), TEXT("((Selector=(Selection=Attribute,AttributeName=\"Score\")))"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("PartitionByValues");
+				Case.Description = TEXT("Partition points on an int attribute with 16 distinct values");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					UPCGBasePointData* Points = SyntheticData::MakeUniformPoints(Outer, Size, DefaultBounds, Seed);
+					SyntheticData::AddIntColumn(Points, FName("Group"), 16, Seed);
+					AddInput(OutInputs, InLabel, Points);
+				};
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsMeta.PCGExPartitionByValuesSettings"))
+					.Set(FName("PartitionRules"), TEXT("((Selector=(Selection=Attribute,AttributeName=\"Group\")))"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("SampleNearestPoint");
+				Case.Description = TEXT("Sample nearest target within range, as many targets as points");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					AddInput(OutInputs, InLabel, SyntheticData::MakeUniformPoints(Outer, Size, DefaultBounds, Seed));
+					AddInput(OutInputs, TargetsLabel, SyntheticData::MakeUniformPoints(Outer, Size, DefaultBounds, Seed + 1));
+				};
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsSampling.PCGExSampleNearestPointSettings"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("RelaxClusters");
+				Case.Description = TEXT("Laplacian relaxation of a jittered grid delaunay cluster");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					AddInput(OutInputs, InLabel, SyntheticData::MakeGridPoints(Outer, Size, 100, 25, Seed));
+				};
+				Case.Setup.Add(FElementStep(TEXT("/Script/PCGExElementsClustersDiagrams.PCGExBuildDelaunayGraphSettings")));
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsClustersRelax.PCGExRelaxClustersSettings"))
+					.Instance(FName("Relaxing"), TEXT("/Script/PCGExElementsClustersRelax.PCGExLaplacianRelax"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("PathfindingEdges");
+				Case.Description = TEXT("A* over a delaunay cluster, one query per 1% of the points");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					const UPCGBasePointData* Points = SyntheticData::MakeGridPoints(Outer, Size, 100, 25, Seed);
+					const int32 NumQueries = FMath::Max(1, Size / 100);
+					AddInput(OutInputs, InLabel, Points);
+					AddInput(OutInputs, SeedsLabel, SyntheticData::MakeSubset(Outer, Points, NumQueries, Seed));
+					AddInput(OutInputs, GoalsLabel, SyntheticData::MakeSubset(Outer, Points, NumQueries, Seed + 1));
+				};
+				Case.Setup.Add(FElementStep(TEXT("/Script/PCGExElementsClustersDiagrams.PCGExBuildDelaunayGraphSettings")));
+				Case.Setup.Add(FElementStep(TEXT("/Script/PCGExHeuristics.PCGExHeuristicsShortestDistanceProviderSettings")));
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsPathfinding.PCGExPathfindingEdgesSettings"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("Clipper2Offset");
+				Case.Description = TEXT("Offset 10 closed spline paths sharing the point budget");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					constexpr int32 NumPaths = 10;
+					for (int i = 0; i < NumPaths; i++)
+					{
+						const FBox Bounds = FBox(FVector(-2000, -2000, 0), FVector(2000, 2000, 0)).ShiftBy(FVector(i * 5000, 0, 0));
+						AddInput(OutInputs, PathsLabel, SyntheticData::MakeSplinePath(Outer, FMath::Max(3, Size / NumPaths), 12, Bounds, true, Seed + i));
+					}
+				};
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsClipper2.PCGExClipper2OffsetSettings"));
+			}
+
+			{
+				FBenchmarkCase& Case = Cases.Emplace_GetRef();
+				Case.Name = TEXT("UberNoise");
+				Case.Description = TEXT("Perlin noise written to a new attribute");
+				Case.MakeInputs = [](UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)
+				{
+					AddInput(OutInputs, InLabel, SyntheticData::MakeUniformPoints(Outer, Size, DefaultBounds, Seed));
+				};
+				Case.Setup.Add(FElementStep(TEXT("/Script/PCGExNoise3D.PCGExNoise3DPerlinProviderSettings")).Remap(FName("Noise"), FName("Noises")));
+				Case.Timed = FElementStep(TEXT("/Script/PCGExElementsMeta.PCGExUberNoiseSettings"));
+			}
+
+			return Cases;
+		}
+	}
+
+	bool FBenchmarkOptions::PassesFilter(const FString& InName) const
+	{
+		if (Filter.IsEmpty()) { return true; }
+
+		TArray<FString> Tokens;
+		Filter.ParseIntoArray(Tokens, TEXT(","), true);
+		for (const FString& Token : Tokens)
+		{
+			if (InName.Contains(Token.TrimStartAndEnd(), ESearchCase::IgnoreCase)) { return true; }
+		}
+
+		return false;
+	}
+
+	void FBenchmarkOptions::ParseParams(const FString& InParams)
+	{
+		FString TiersList;
+		if (FParse::Value(*InParams, TEXT("Tiers="), TiersList, false))
+		{
+			TArray<FString> Tokens;
+			TiersList.ParseIntoArray(Tokens, TEXT(","), true);
+
+			Tiers.Reset();
+			for (const FString& Token : Tokens)
+			{
+				const int32 Size = FCString::Atoi(*Token);
+				if (Size > 0) { Tiers.Add(Size); }
+			}
+		}
+
+		FParse::Value(*InParams, TEXT("Filter="), Filter, false);
+		FParse::Value(*InParams, TEXT("Iterations="), Iterations);
+		FParse::Value(*InParams, TEXT("Warmup="), WarmupIterations);
+		FParse::Value(*InParams, TEXT("Seed="), Seed);
+		FParse::Value(*InParams, TEXT("Timeout="), Timeout);
+		if (FParse::Param(*InParams, TEXT("Phases"))) { bRecordPhases = true; }
+	}
+
+	void FBenchmarkResult::ComputeStats()
+	{
+		Median = Min = Max = Mean = StdDev = 0;
+		if (Samples.IsEmpty()) { return; }
+
+		Median = ComputeMedian(Samples);
+		Min = Samples[0];
+		Max = Samples[0];
+
+		for (const double Sample : Samples)
+		{
+			Min = FMath::Min(Min, Sample);
+			Max = FMath::Max(Max, Sample);
+			Mean += Sample;
+		}
+
+		Mean /= Samples.Num();
+
+		for (const double Sample : Samples) { StdDev += FMath::Square(Sample - Mean); }
+		StdDev = FMath::Sqrt(StdDev / Samples.Num());
+	}
+
+	TSharedRef<FJsonObject> FBenchmarkResult::ToJson() const
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+		Object->SetStringField(TEXT("Name"), Name);
+		Object->SetNumberField(TEXT("Size"), Size);
+		Object->SetBoolField(TEXT("Success"), bSuccess);
+		if (!Error.IsEmpty()) { Object->SetStringField(TEXT("Error"), Error); }
+
+		TArray<TSharedPtr<FJsonValue>> JsonSamples;
+		for (const double Sample : Samples) { JsonSamples.Add(MakeShared<FJsonValueNumber>(Sample)); }
+		Object->SetArrayField(TEXT("Samples"), JsonSamples);
+
+		Object->SetNumberField(TEXT("Median"), Median);
+		Object->SetNumberField(TEXT("Min"), Min);
+		Object->SetNumberField(TEXT("Max"), Max);
+		Object->SetNumberField(TEXT("Mean"), Mean);
+		Object->SetNumberField(TEXT("StdDev"), StdDev);
+		Object->SetNumberField(TEXT("NumAllocations"), NumAllocations);
+		Object->SetNumberField(TEXT("AllocatedBytes"), AllocatedBytes);
+		Object->SetNumberField(TEXT("NumOutputData"), NumOutputData);
+		Object->SetNumberField(TEXT("NumOutputPoints"), NumOutputPoints);
+
+		if (!Phases.IsEmpty())
+		{
+			const TSharedRef<FJsonObject> JsonPhases = MakeShared<FJsonObject>();
+			for (const TPair<FString, double>& Phase : Phases) { JsonPhases->SetNumberField(Phase.Key, Phase.Value); }
+			Object->SetObjectField(TEXT("Phases"), JsonPhases);
+		}
+
+		return Object;
+	}
+
+	bool FBenchmarkResult::FromJson(const TSharedPtr<FJsonObject>& InObject, FBenchmarkResult& OutResult)
+	{
+		if (!InObject.IsValid() || !InObject->TryGetStringField(TEXT("Name"), OutResult.Name)) { return false; }
+
+		InObject->TryGetNumberField(TEXT("Size"), OutResult.Size);
+		InObject->TryGetBoolField(TEXT("Success"), OutResult.bSuccess);
+		InObject->TryGetStringField(TEXT("Error"), OutResult.Error);
+
+		OutResult.Samples.Reset();
+		const TArray<TSharedPtr<FJsonValue>>* JsonSamples = nullptr;
+		if (InObject->TryGetArrayField(TEXT("Samples"), JsonSamples))
+		{
+			for (const TSharedPtr<FJsonValue>& Sample : *JsonSamples) { OutResult.Samples.Add(Sample->AsNumber()); }
+		}
+
+		OutResult.ComputeStats();
+
+		InObject->TryGetNumberField(TEXT("NumAllocations"), OutResult.NumAllocations);
+		InObject->TryGetNumberField(TEXT("AllocatedBytes"), OutResult.AllocatedBytes);
+		InObject->TryGetNumberField(TEXT("NumOutputData"), OutResult.NumOutputData);
+		InObject->TryGetNumberField(TEXT("NumOutputPoints"), OutResult.NumOutputPoints);
+
+		OutResult.Phases.Reset();
+		const TSharedPtr<FJsonObject>* JsonPhases = nullptr;
+		if (InObject->TryGetObjectField(TEXT("Phases"), JsonPhases))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Phase : (*JsonPhases)->Values) { OutResult.Phases.Add(Phase.Key, Phase.Value->AsNumber()); }
+		}
+
+		return true;
+	}
+
+	const TArray<FBenchmarkCase>& GetBuiltinCases()
+	{
+		static const TArray<FBenchmarkCase> Cases = MakeBuiltinCases();
+		return Cases;
+	}
+
+	FBenchmarkResult RunCase(const FBenchmarkCase& InCase, const int32 InSize, const FBenchmarkOptions& InOptions)
+	{
+		FBenchmarkResult Result;
+		Result.Name = InCase.Name;
+		Result.Size = InSize;
+
+		FRunner Runner;
+		Runner.Timeout = InOptions.Timeout;
+
+		FRootScope Roots;
+		UObject* Outer = GetTransientPackage();
+
+		FPCGDataCollection Inputs;
+		if (!PrepareInputs(InCase, InSize, InOptions, Runner, Outer, Roots, Inputs, Result.Error)) { return Result; }
+
+		UPCGSettings* Settings = Runner.CreateSettings(Outer, InCase.Timed, Result.Error);
+		if (!Settings) { return Result; }
+		Settings->AddToRoot();
+
+		TArray<int64> Allocations;
+		TArray<int64> Bytes;
+
+		const int32 NumRuns = FMath::Max(0, InOptions.WarmupIterations) + FMath::Max(1, InOptions.Iterations);
+		for (int i = 0; i < NumRuns; i++)
+		{
+			FPCGDataCollection Outputs;
+			const FStepResult StepResult = Runner.Execute(Settings, Inputs, Outputs, &InCase.Timed);
+
+			if (!StepResult.bSuccess)
+			{
+				Result.Error = StepResult.Error;
+				break;
+			}
+
+			if (i < InOptions.WarmupIterations) { continue; }
+
+			Result.Samples.Add(StepResult.Seconds);
+			Allocations.Add(StepResult.NumAllocations);
+			Bytes.Add(StepResult.AllocatedBytes);
+			Result.NumOutputData = StepResult.NumOutputData;
+			Result.NumOutputPoints = StepResult.NumOutputPoints;
+		}
+
+		if (InOptions.bRecordPhases && Result.Error.IsEmpty())
+		{
+			// Separate run so telemetry overhead never leaks into the timed samples
+			using namespace PCGExMT::Telemetry;
+
+			// Set aside whatever the user recorded so far, and put it back once done
+			TArray<TSharedPtr<FExecutionRecord>> PreviousExecutions;
+			FRegistry::Get().SwapExecutions(PreviousExecutions);
+
+			const bool bWasEnabled = IsEnabled();
+			SetEnabled(true);
+
+			FPCGDataCollection Outputs;
+			Runner.Execute(Settings, Inputs, Outputs, &InCase.Timed);
+
+			TArray<TSharedPtr<FExecutionRecord>> Executions;
+			FRegistry::Get().GetExecutions(Executions);
+
+			TArray<FGroupStats> Stats;
+			for (const TSharedPtr<FExecutionRecord>& Execution : Executions)
+			{
+				Stats.Reset();
+				Execution->GetGroupStats(Stats);
+				for (const FGroupStats& Group : Stats) { Result.Phases.FindOrAdd(Group.Name.ToString()) += Group.BusySeconds; }
+			}
+
+			SetEnabled(bWasEnabled);
+			FRegistry::Get().SwapExecutions(PreviousExecutions);
+		}
+
+		Settings->RemoveFromRoot();
+
+		Result.bSuccess = Result.Error.IsEmpty() && !Result.Samples.IsEmpty();
+		Result.ComputeStats();
+
+		if (FAllocationCounter::IsInstalled())
+		{
+			Result.NumAllocations = ComputeMedian(Allocations);
+			Result.AllocatedBytes = ComputeMedian(Bytes);
+		}
+
+		return Result;
+	}
+
+	bool ExecuteCase(const FBenchmarkCase& InCase, const int32 InSize, const FBenchmarkOptions& InOptions, TFunctionRef<void(const FPCGDataCollection& InOutputs)>&& OnOutputs, FString& OutError)
+	{
+		FRunner Runner;
+		Runner.Timeout = InOptions.Timeout;
+
+		FRootScope Roots;
+		UObject* Outer = GetTransientPackage();
+
+		FPCGDataCollection Inputs;
+		if (!PrepareInputs(InCase, InSize, InOptions, Runner, Outer, Roots, Inputs, OutError)) { return false; }
+
+		FPCGDataCollection Outputs;
+		const FStepResult StepResult = Runner.Run(Outer, InCase.Timed, Inputs, Outputs);
+		if (!StepResult.bSuccess)
+		{
+			OutError = StepResult.Error;
+			return false;
+		}
+
+		OnOutputs(Outputs);
+		return true;
+	}
+
+	void RunCases(const TArray<FBenchmarkCase>& InCases, const FBenchmarkOptions& InOptions, TArray<FBenchmarkResult>& OutResults)
+	{
+		for (const FBenchmarkCase& Case : InCases)
+		{
+			if (!InOptions.PassesFilter(Case.Name)) { continue; }
+
+			for (const int32 Size : InOptions.Tiers)
+			{
+				UE_LOG(LogPCGEx, Display, TEXT("[Benchmark] %s @ %d ..."), *Case.Name, Size);
+				OutResults.Add(RunCase(Case, Size, InOptions));
+
+				// Keep cases independent from each other's garbage
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			}
+		}
+	}
+
+	bool WriteResultsJson(const FString& InFilePath, const TArray<FBenchmarkResult>& InResults, const FBenchmarkOptions& InOptions, const TMap<FString, FString>& InMetadata)
+	{
+		const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("Version"), ResultsVersion);
+		Root->SetStringField(TEXT("CreatedAt"), FDateTime::UtcNow().ToIso8601());
+		Root->SetStringField(TEXT("Engine"), FEngineVersion::Current().ToString());
+		Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+		Root->SetStringField(TEXT("BuildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+		Root->SetNumberField(TEXT("Seed"), InOptions.Seed);
+		Root->SetNumberField(TEXT("Iterations"), InOptions.Iterations);
+
+		if (!InMetadata.IsEmpty())
+		{
+			const TSharedRef<FJsonObject> JsonMetadata = MakeShared<FJsonObject>();
+			for (const TPair<FString, FString>& Entry : InMetadata) { JsonMetadata->SetStringField(Entry.Key, Entry.Value); }
+			Root->SetObjectField(TEXT("Metadata"), JsonMetadata);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> JsonResults;
+		for (const FBenchmarkResult& Result : InResults) { JsonResults.Add(MakeShared<FJsonValueObject>(Result.ToJson())); }
+		Root->SetArrayField(TEXT("Results"), JsonResults);
+
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		if (!FJsonSerializer::Serialize(Root, Writer)) { return false; }
+
+		return FFileHelper::SaveStringToFile(Output, *InFilePath);
+	}
+
+	bool ReadResultsJson(const FString& InFilePath, TArray<FBenchmarkResult>& OutResults, TMap<FString, FString>* OutMetadata)
+	{
+		FString Input;
+		if (!FFileHelper::LoadFileToString(Input, *InFilePath)) { return false; }
+
+		TSharedPtr<FJsonObject> Root;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Input), Root) || !Root.IsValid()) { return false; }
+
+		int32 Version = 0;
+		if (!Root->TryGetNumberField(TEXT("Version"), Version) || Version > ResultsVersion)
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("%s : unsupported results version %d (expected <= %d)"), *InFilePath, Version, ResultsVersion);
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonResults = nullptr;
+		if (!Root->TryGetArrayField(TEXT("Results"), JsonResults)) { return false; }
+
+		if (OutMetadata)
+		{
+			OutMetadata->Add(TEXT("Engine"), Root->GetStringField(TEXT("Engine")));
+			OutMetadata->Add(TEXT("Platform"), Root->GetStringField(TEXT("Platform")));
+			OutMetadata->Add(TEXT("CreatedAt"), Root->GetStringField(TEXT("CreatedAt")));
+
+			const TSharedPtr<FJsonObject>* JsonMetadata = nullptr;
+			if (Root->TryGetObjectField(TEXT("Metadata"), JsonMetadata))
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*JsonMetadata)->Values) { OutMetadata->Add(Entry.Key, Entry.Value->AsString()); }
+			}
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *JsonResults)
+		{
+			FBenchmarkResult Result;
+			if (FBenchmarkResult::FromJson(Value->AsObject(), Result)) { OutResults.Add(MoveTemp(Result)); }
+		}
+
+		return true;
+	}
+
+	bool WriteResultsCSV(const FString& InFilePath, const TArray<FBenchmarkResult>& InResults)
+	{
+		FString Output = TEXT("Name,Size,Success,MedianMs,MinMs,MaxMs,MeanMs,StdDevMs,NumAllocations,AllocatedBytes,NumOutputData,NumOutputPoints,Error\n");
+		for (const FBenchmarkResult& Result : InResults)
+		{
+			Output += FString::Printf(
+				TEXT("%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%lld,%lld,%d,%lld,\"%s\"\n"),
+				*Result.Name, Result.Size, Result.bSuccess ? 1 : 0,
+				Result.Median * 1000, Result.Min * 1000, Result.Max * 1000, Result.Mean * 1000, Result.StdDev * 1000,
+				Result.NumAllocations, Result.AllocatedBytes, Result.NumOutputData, Result.NumOutputPoints,
+				*Result.Error.Replace(TEXT("\""), TEXT("'")));
+		}
+
+		return FFileHelper::SaveStringToFile(Output, *InFilePath);
+	}
+
+	void LogResults(const TArray<FBenchmarkResult>& InResults)
+	{
+		UE_LOG(LogPCGEx, Display, TEXT("%-24s %8s %12s %12s %10s %14s %12s"), TEXT("Case"), TEXT("Size"), TEXT("Median ms"), TEXT("Min ms"), TEXT("StdDev %"), TEXT("Allocs"), TEXT("Out points"));
+
+		for (const FBenchmarkResult& Result : InResults)
+		{
+			if (!Result.bSuccess)
+			{
+				UE_LOG(LogPCGEx, Warning, TEXT("%-24s %8d FAILED: %s"), *Result.Name, Result.Size, *Result.Error);
+				continue;
+			}
+
+			UE_LOG(
+				LogPCGEx, Display, TEXT("%-24s %8d %12.3f %12.3f %10.1f %14lld %12lld"),
+				*Result.Name, Result.Size, Result.Median * 1000, Result.Min * 1000,
+				Result.Mean > 0 ? Result.StdDev / Result.Mean * 100 : 0,
+				Result.NumAllocations, Result.NumOutputPoints);
+		}
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBenchmarks.h"
+
+#define LOCTEXT_NAMESPACE "FPCGExBenchmarksModule"
+
+void FPCGExBenchmarksModule::StartupModule()
+{
+	IPCGExEditorModuleInterface::StartupModule();
+}
+
+void FPCGExBenchmarksModule::ShutdownModule()
+{
+	IPCGExEditorModuleInterface::ShutdownModule();
+}
+
+#undef LOCTEXT_NAMESPACE
+
+PCGEX_IMPLEMENT_MODULE(FPCGExBenchmarksModule, PCGExBenchmarks)
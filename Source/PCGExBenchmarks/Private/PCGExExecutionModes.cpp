@@ -0,0 +1,123 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExExecutionModes.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExBenchmarks::ExecutionModes
+{
+	namespace
+	{
+		/** Settings cache snapshot; modes restore it wholesale rather than tracking what they touched. */
+		struct FSettingsSnapshot
+		{
+			bool bBulkInitData = false;
+			bool bCacheClusters = true;
+			bool bDefaultBuildAndCacheClusters = true;
+			bool bDefaultScopedAttributeGet = true;
+			int32 PointsDefaultBatchChunkSize = 1024;
+			int32 ClusterDefaultBatchChunkSize = 512;
+			bool bForceSingleThreaded = false;
+
+			void Capture()
+			{
+				const FPCGExCoreSettingsCache& Settings = PCGEX_CORE_SETTINGS;
+				bBulkInitData = Settings.bBulkInitData;
+				bCacheClusters = Settings.bCacheClusters;
+				bDefaultBuildAndCacheClusters = Settings.bDefaultBuildAndCacheClusters;
+				bDefaultScopedAttributeGet = Settings.bDefaultScopedAttributeGet;
+				PointsDefaultBatchChunkSize = Settings.PointsDefaultBatchChunkSize;
+				ClusterDefaultBatchChunkSize = Settings.ClusterDefaultBatchChunkSize;
+				bForceSingleThreaded = PCGExMT::IsForcedSingleThreaded();
+			}
+
+			void Restore() const
+			{
+				FPCGExCoreSettingsCache& Settings = PCGEX_CORE_SETTINGS;
+				Settings.bBulkInitData = bBulkInitData;
+				Settings.bCacheClusters = bCacheClusters;
+				Settings.bDefaultBuildAndCacheClusters = bDefaultBuildAndCacheClusters;
+				Settings.bDefaultScopedAttributeGet = bDefaultScopedAttributeGet;
+				Settings.PointsDefaultBatchChunkSize = PointsDefaultBatchChunkSize;
+				Settings.ClusterDefaultBatchChunkSize = ClusterDefaultBatchChunkSize;
+				PCGExMT::SetForceSingleThreaded(bForceSingleThreaded);
+			}
+		};
+
+		FSettingsSnapshot GSnapshot;
+
+		FExecutionMode MakeMode(const TCHAR* InName, const TCHAR* InDescription, TFunction<void(FPCGExCoreSettingsCache&)>&& InApply)
+		{
+			FExecutionMode Mode;
+			Mode.Name = InName;
+			Mode.Description = InDescription;
+			Mode.Enter = [Apply = MoveTemp(InApply)]()
+			{
+				GSnapshot.Capture();
+				Apply(PCGEX_CORE_SETTINGS);
+			};
+			Mode.Exit = []() { GSnapshot.Restore(); };
+			return Mode;
+		}
+
+		TArray<FExecutionMode> MakeBuiltinModes()
+		{
+			TArray<FExecutionMode> Modes;
+
+			Modes.Add(MakeMode(TEXT("Default"), TEXT("Current settings, parallel."), [](FPCGExCoreSettingsCache&) {}));
+
+			Modes.Add(MakeMode(TEXT("SingleThreaded"), TEXT("Every parallel loop and task-group iteration runs inline."), [](FPCGExCoreSettingsCache&) { PCGExMT::SetForceSingleThreaded(true); }));
+
+			Modes.Add(MakeMode(TEXT("SmallBatches"), TEXT("Tiny default chunk sizes, maximizes scope boundaries."), [](FPCGExCoreSettingsCache& Settings)
+			{
+				Settings.PointsDefaultBatchChunkSize = 32;
+				Settings.ClusterDefaultBatchChunkSize = 32;
+			}));
+
+			Modes.Add(MakeMode(TEXT("BulkInit"), TEXT("Flips bulk data initialization."), [](FPCGExCoreSettingsCache& Settings) { Settings.bBulkInitData = !Settings.bBulkInitData; }));
+
+			Modes.Add(MakeMode(TEXT("NoClusterCache"), TEXT("Clusters are rebuilt from raw vtx/edges instead of cached."), [](FPCGExCoreSettingsCache& Settings)
+			{
+				Settings.bCacheClusters = false;
+				Settings.bDefaultBuildAndCacheClusters = false;
+			}));
+
+			Modes.Add(MakeMode(TEXT("NoScopedGet"), TEXT("Attribute readers fetch everything upfront."), [](FPCGExCoreSettingsCache& Settings) { Settings.bDefaultScopedAttributeGet = false; }));
+
+			return Modes;
+		}
+	}
+
+	const TArray<FExecutionMode>& GetBuiltinModes()
+	{
+		static const TArray<FExecutionMode> Modes = MakeBuiltinModes();
+		return Modes;
+	}
+
+	void GetModes(const FString& InNames, TArray<FExecutionMode>& OutModes)
+	{
+		const TArray<FExecutionMode>& Modes = GetBuiltinModes();
+
+		TArray<FString> Names;
+		InNames.ParseIntoArray(Names, TEXT(","));
+		for (FString& Name : Names) { Name.TrimStartAndEndInline(); }
+
+		for (int i = 0; i < Modes.Num(); i++)
+		{
+			if (i == 0 || Names.IsEmpty() || Names.Contains(Modes[i].Name)) { OutModes.Add(Modes[i]); }
+		}
+	}
+
+	FScopedMode::FScopedMode(const FExecutionMode& InMode)
+		: Mode(InMode)
+	{
+		if (Mode.Enter) { Mode.Enter(); }
+	}
+
+	FScopedMode::~FScopedMode()
+	{
+		if (Mode.Exit) { Mode.Exit(); }
+	}
+}
@@ -0,0 +1,215 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExSyntheticData.h"
+
+#include "Data/PCGPointArrayData.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
+#include "Math/InterpCurve.h"
+#include "Math/RandomStream.h"
+#include "Metadata/PCGMetadata.h"
+
+namespace PCGExBenchmarks::SyntheticData
+{
+	namespace
+	{
+		UPCGBasePointData* AllocatePoints(UObject* Outer, const int32 NumPoints)
+		{
+			UPCGBasePointData* Data = NewObject<UPCGPointArrayData>(Outer ? Outer : GetTransientPackage());
+			PCGExPointArrayDataHelpers::SetNumPointsAllocated(Data, FMath::Max(0, NumPoints));
+
+			TPCGValueRange<FVector> BoundsMin = Data->GetBoundsMinValueRange(false);
+			TPCGValueRange<FVector> BoundsMax = Data->GetBoundsMaxValueRange(false);
+			TPCGValueRange<float> Density = Data->GetDensityValueRange(false);
+			TPCGValueRange<int32> Seeds = Data->GetSeedValueRange(false);
+
+			for (int i = 0; i < NumPoints; i++)
+			{
+				BoundsMin[i] = FVector(-1);
+				BoundsMax[i] = FVector(1);
+				Density[i] = 1;
+				Seeds[i] = i;
+			}
+
+			return Data;
+		}
+
+		void EnsureMetadataEntries(UPCGBasePointData* InData)
+		{
+			TPCGValueRange<int64> Entries = InData->GetMetadataEntryValueRange(false);
+			for (int64& Entry : Entries)
+			{
+				if (Entry == PCGInvalidEntryKey) { Entry = InData->Metadata->AddEntry(); }
+			}
+		}
+
+		FVector RandomInBox(FRandomStream& Random, const FBox& Bounds)
+		{
+			return FVector(
+				Random.FRandRange(Bounds.Min.X, Bounds.Max.X),
+				Random.FRandRange(Bounds.Min.Y, Bounds.Max.Y),
+				Random.FRandRange(Bounds.Min.Z, Bounds.Max.Z));
+		}
+	}
+
+	UPCGBasePointData* MakeUniformPoints(UObject* Outer, const int32 NumPoints, const FBox& Bounds, const int32 Seed)
+	{
+		UPCGBasePointData* Data = AllocatePoints(Outer, NumPoints);
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+
+		FRandomStream Random(Seed);
+		for (int i = 0; i < NumPoints; i++) { Transforms[i] = FTransform(RandomInBox(Random, Bounds)); }
+
+		return Data;
+	}
+
+	UPCGBasePointData* MakeClusteredPoints(UObject* Outer, const int32 NumPoints, const int32 NumClusters, const double Radius, const FBox& Bounds, const int32 Seed)
+	{
+		UPCGBasePointData* Data = AllocatePoints(Outer, NumPoints);
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+
+		FRandomStream Random(Seed);
+
+		TArray<FVector> Centers;
+		Centers.SetNumUninitialized(FMath::Max(1, NumClusters));
+		for (FVector& Center : Centers) { Center = RandomInBox(Random, Bounds); }
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			// Sum of uniforms approximates a gaussian falloff while staying deterministic across platforms
+			const FVector& Center = Centers[Random.RandHelper(Centers.Num())];
+			const double Distance = Radius * (Random.FRand() + Random.FRand() + Random.FRand()) / 3.0;
+			Transforms[i] = FTransform(Center + Random.GetUnitVector() * Distance);
+		}
+
+		return Data;
+	}
+
+	UPCGBasePointData* MakeGridPoints(UObject* Outer, const int32 NumPoints, const double Spacing, const double Jitter, const int32 Seed)
+	{
+		const int32 Side = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<double>(NumPoints))));
+		const int32 Num = Side * Side;
+
+		UPCGBasePointData* Data = AllocatePoints(Outer, Num);
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+
+		FRandomStream Random(Seed);
+		for (int i = 0; i < Num; i++)
+		{
+			const FVector Offset = Jitter > 0 ? FVector(Random.FRandRange(-Jitter, Jitter), Random.FRandRange(-Jitter, Jitter), 0) : FVector::ZeroVector;
+			Transforms[i] = FTransform(FVector((i % Side) * Spacing, (i / Side) * Spacing, 0) + Offset);
+		}
+
+		return Data;
+	}
+
+	UPCGBasePointData* MakeRandomWalkPath(UObject* Outer, const int32 NumPoints, const double StepSize, const int32 Seed)
+	{
+		UPCGBasePointData* Data = AllocatePoints(Outer, NumPoints);
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+
+		FRandomStream Random(Seed);
+		FVector Position = FVector::ZeroVector;
+		double Heading = 0;
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			Transforms[i] = FTransform(FRotator(0, FMath::RadiansToDegrees(Heading), 0), Position);
+			Heading += Random.FRandRange(-PI * 0.25, PI * 0.25);
+			Position += FVector(FMath::Cos(Heading), FMath::Sin(Heading), 0) * StepSize;
+		}
+
+		return Data;
+	}
+
+	UPCGBasePointData* MakeSplinePath(UObject* Outer, const int32 NumPoints, const int32 NumControlPoints, const FBox& Bounds, const bool bClosedLoop, const int32 Seed)
+	{
+		UPCGBasePointData* Data = AllocatePoints(Outer, NumPoints);
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+
+		FRandomStream Random(Seed);
+
+		const int32 NumControls = FMath::Max(2, NumControlPoints);
+		FInterpCurveVector Curve;
+		for (int i = 0; i < NumControls; i++)
+		{
+			const int32 Index = Curve.AddPoint(i, RandomInBox(Random, Bounds));
+			Curve.Points[Index].InterpMode = CIM_CurveAuto;
+		}
+
+		if (bClosedLoop) { Curve.SetLoopKey(NumControls); }
+		Curve.AutoSetTangents();
+
+		const double MaxKey = bClosedLoop ? NumControls : NumControls - 1;
+		const double Step = NumPoints > 1 ? MaxKey / (bClosedLoop ? NumPoints : NumPoints - 1) : 0;
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			const float Key = static_cast<float>(i * Step);
+			const FVector Position = Curve.Eval(Key);
+			const FVector Tangent = Curve.EvalDerivative(Key).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+			Transforms[i] = FTransform(Tangent.Rotation(), Position);
+		}
+
+		return Data;
+	}
+
+	void AddIntColumn(UPCGBasePointData* InData, const FName Name, const int32 Cardinality, const int32 Seed)
+	{
+		EnsureMetadataEntries(InData);
+
+		FPCGMetadataAttribute<int32>* Attribute = InData->Metadata->FindOrCreateAttribute<int32>(Name, 0, false, true);
+		const TConstPCGValueRange<int64> Entries = InData->GetConstMetadataEntryValueRange();
+
+		FRandomStream Random(Seed);
+		const int32 SafeCardinality = FMath::Max(1, Cardinality);
+		for (const int64 Entry : Entries) { Attribute->SetValue(Entry, Random.RandHelper(SafeCardinality)); }
+	}
+
+	void AddDoubleColumn(UPCGBasePointData* InData, const FName Name, const double Min, const double Max, const int32 Seed)
+	{
+		EnsureMetadataEntries(InData);
+
+		FPCGMetadataAttribute<double>* Attribute = InData->Metadata->FindOrCreateAttribute<double>(Name, 0, true, true);
+		const TConstPCGValueRange<int64> Entries = InData->GetConstMetadataEntryValueRange();
+
+		FRandomStream Random(Seed);
+		for (const int64 Entry : Entries) { Attribute->SetValue(Entry, Random.FRandRange(Min, Max)); }
+	}
+
+	void AddNameColumn(UPCGBasePointData* InData, const FName Name, const int32 Cardinality, const int32 Seed)
+	{
+		EnsureMetadataEntries(InData);
+
+		const int32 SafeCardinality = FMath::Max(1, Cardinality);
+		TArray<FName> Values;
+		Values.SetNum(SafeCardinality);
+		for (int i = 0; i < SafeCardinality; i++) { Values[i] = FName(TEXT("Value"), i + 1); }
+
+		FPCGMetadataAttribute<FName>* Attribute = InData->Metadata->FindOrCreateAttribute<FName>(Name, NAME_None, false, true);
+		const TConstPCGValueRange<int64> Entries = InData->GetConstMetadataEntryValueRange();
+
+		FRandomStream Random(Seed);
+		for (const int64 Entry : Entries) { Attribute->SetValue(Entry, Values[Random.RandHelper(SafeCardinality)]); }
+	}
+
+	UPCGBasePointData* MakeSubset(UObject* Outer, const UPCGBasePointData* InData, const int32 NumPoints, const int32 Seed)
+	{
+		const int32 NumSource = InData ? InData->GetNumPoints() : 0;
+		const int32 Num = FMath::Min(NumPoints, NumSource);
+
+		UPCGBasePointData* Data = AllocatePoints(Outer, Num);
+		if (!Num) { return Data; }
+
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+		const TConstPCGValueRange<FTransform> SourceTransforms = InData->GetConstTransformValueRange();
+
+		// Fixed stride from a seeded offset: deterministic and spread over the whole source
+		FRandomStream Random(Seed);
+		const int32 Stride = FMath::Max(1, NumSource / Num);
+		const int32 Offset = Random.RandHelper(Stride);
+		for (int i = 0; i < Num; i++) { Transforms[i] = SourceTransforms[(Offset + i * Stride) % NumSource]; }
+
+		return Data;
+	}
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs the built-in benchmark suite headless, on synthetic data (no world, no assets, no rendering).
+ *
+ * UnrealEditor-Cmd <Project> -run=PCGExBenchmark [-Filter=Fuse,Sort] [-Tiers=1000,10000] [-Iterations=5]
+ *   [-Warmup=1] [-Seed=1337] [-Timeout=600] [-Phases] [-Output=<File.json>] [-CSV=<File.csv>] [-CountAllocs] [-List]
+ */
+UCLASS()
+class UPCGExBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
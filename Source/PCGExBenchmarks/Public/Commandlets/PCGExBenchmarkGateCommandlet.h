@@ -0,0 +1,30 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExBenchmarkGateCommandlet.generated.h"
+
+/**
+ * Performance regression gate: runs a benchmark manifest and compares it against a stored baseline.
+ * Returns non-zero when any case regressed or failed, so it can be used as a CI step.
+ *
+ * UnrealEditor-Cmd <Project> -run=PCGExBenchmarkGate [-Manifest=<File.json>] [-Baseline=<File.json>]
+ *   [-UpdateBaseline] [-Report=<File.json>] [-Revision=<Id>] + any PCGExBenchmark option (-Tiers=, -Iterations=, ...)
+ *
+ * The baseline defaults to <ProjectSaved>/PCGEx/Baselines/<Platform>/<ManifestName>.json. When it does not exist
+ * yet, the current run is stored as the new baseline and the gate passes.
+ */
+UCLASS()
+class UPCGExBenchmarkGateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExBenchmarkGateCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
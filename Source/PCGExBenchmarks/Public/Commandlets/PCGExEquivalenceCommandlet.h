@@ -0,0 +1,30 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExEquivalenceCommandlet.generated.h"
+
+/**
+ * Output-equivalence check: executes every benchmark case once per execution mode (parallel, single-threaded,
+ * small batches, bulk init...) and compares output fingerprints against the first mode.
+ * Returns non-zero when any case diverges or fails.
+ *
+ * UnrealEditor-Cmd <Project> -run=PCGExEquivalence [-Filter=] [-Tiers=] [-Seed=] [-Modes=A,B]
+ *   [-Tolerance=<Step>] [-Ordered] [-MaxDiffs=<N>]
+ *
+ * Point order is ignored by default since several elements legitimately emit in completion order; -Ordered makes it count.
+ */
+UCLASS()
+class UPCGExEquivalenceCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExEquivalenceCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
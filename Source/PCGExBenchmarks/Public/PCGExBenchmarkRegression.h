@@ -0,0 +1,111 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExBenchmarkSuite.h"
+
+/**
+ * Baseline comparison for benchmark results.
+ *
+ * A case regresses when its median slowed down by more than the largest of:
+ * - RelativeTolerance * baseline median,
+ * - NoiseSigmas * pooled robust sigma (1.4826 * MAD of both sample sets),
+ * - MinAbsoluteSeconds,
+ * and, when both runs have enough samples, a two-sided Mann-Whitney U test rejects "same distribution" at Significance.
+ */
+namespace PCGExBenchmarks::Regression
+{
+	struct PCGEXBENCHMARKS_API FThresholds
+	{
+		double RelativeTolerance = 0.1;
+		double NoiseSigmas = 3.0;
+		double MinAbsoluteSeconds = 0.0005;
+		double Significance = 0.05;
+
+		/** Below this many samples on either side the rank test is skipped and the threshold alone decides. */
+		int32 MinSamplesForTest = 5;
+
+		void FromJson(const TSharedPtr<FJsonObject>& InObject);
+	};
+
+	/** Benchmark run description, loaded from a JSON manifest. */
+	struct PCGEXBENCHMARKS_API FManifest
+	{
+		FString Name = TEXT("Default");
+		TArray<FString> Cases; // Exact case names; empty means all built-in cases
+		FBenchmarkOptions Options;
+		FThresholds Thresholds;
+		TMap<FString, FThresholds> CaseThresholds; // Per-case overrides, keyed by case name
+
+		FManifest();
+
+		/**
+		 * {
+		 *   "Name": "Nightly", "Cases": ["FusePoints", "PathfindingEdges"], "Tiers": [1000, 100000],
+		 *   "Iterations": 9, "Warmup": 2, "Seed": 1337, "Timeout": 600, "RecordPhases": true,
+		 *   "Thresholds": {"Relative": 0.1, "NoiseSigmas": 3, "MinAbsoluteMs": 0.5, "Significance": 0.05},
+		 *   "CaseThresholds": {"PathfindingEdges": {"Relative": 0.2}}
+		 * }
+		 */
+		bool LoadFromFile(const FString& InFilePath, FString& OutError);
+
+		const FThresholds& GetThresholds(const FString& InCaseName) const;
+		void GetCases(TArray<FBenchmarkCase>& OutCases) const;
+	};
+
+	enum class EVerdict : uint8
+	{
+		Unchanged = 0,
+		Improved,
+		Regressed,
+		Failed,     // Current run failed
+		NoBaseline, // New case or tier, nothing to compare against
+	};
+
+	PCGEXBENCHMARKS_API const TCHAR* LexToString(const EVerdict InVerdict);
+
+	struct PCGEXBENCHMARKS_API FPhaseDelta
+	{
+		FString Name;
+		double Baseline = 0;
+		double Current = 0;
+	};
+
+	struct PCGEXBENCHMARKS_API FComparison
+	{
+		FString Key;
+		EVerdict Verdict = EVerdict::Unchanged;
+
+		double BaselineMedian = 0;
+		double CurrentMedian = 0;
+		double Threshold = 0;
+		double PValue = 1; // 1 when the rank test was skipped
+
+		TArray<FPhaseDelta> Phases; // Sorted by absolute delta, largest first
+		FString Error;
+
+		double GetDelta() const { return CurrentMedian - BaselineMedian; }
+		double GetRelativeDelta() const { return BaselineMedian > 0 ? GetDelta() / BaselineMedian : 0; }
+
+		FString ToString(const int32 MaxPhases = 3) const;
+		TSharedRef<FJsonObject> ToJson() const;
+	};
+
+	/** Scaled median absolute deviation, a robust estimate of the standard deviation. */
+	PCGEXBENCHMARKS_API double RobustSigma(const TArray<double>& InSamples);
+
+	/** Two-sided Mann-Whitney U test, normal approximation with tie correction. */
+	PCGEXBENCHMARKS_API double MannWhitneyPValue(const TArray<double>& A, const TArray<double>& B);
+
+	PCGEXBENCHMARKS_API FComparison Compare(const FBenchmarkResult& InBaseline, const FBenchmarkResult& InCurrent, const FThresholds& InThresholds);
+
+	/** One comparison per current result, in order. Baseline entries without a current counterpart are ignored. */
+	PCGEXBENCHMARKS_API void CompareAll(const TArray<FBenchmarkResult>& InBaseline, const TArray<FBenchmarkResult>& InCurrent, const FManifest& InManifest, TArray<FComparison>& OutComparisons);
+
+	/** Logs the per-benchmark report; returns the number of regressed or failed entries. */
+	PCGEXBENCHMARKS_API int32 LogReport(const TArray<FComparison>& InComparisons);
+
+	PCGEXBENCHMARKS_API bool WriteReportJson(const FString& InFilePath, const TArray<FComparison>& InComparisons, const TMap<FString, FString>& InMetadata);
+}
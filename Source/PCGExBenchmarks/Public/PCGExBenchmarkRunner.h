@@ -0,0 +1,101 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGData.h"
+
+class UPCGSettings;
+
+/**
+ * Headless execution of a single PCG element outside of any graph, component or world.
+ * Settings are resolved by class path and configured through reflection, which keeps this module free of
+ * link-time dependencies on the element modules it benchmarks.
+ */
+namespace PCGExBenchmarks
+{
+	/** One element invocation: settings class, property overrides (ImportText format) and instanced sub-objects. */
+	struct PCGEXBENCHMARKS_API FElementStep
+	{
+		FString SettingsClass; // e.g "/Script/PCGExElementsSpatial.PCGExFusePointsSettings"
+		TMap<FName, FString> Properties;
+		TMap<FName, FString> InstancedObjects; // Property -> class path of the sub-object to instantiate
+
+		/** Rename output pins when the output of this step is fed to the next one, e.g. "Noise" -> "Noises" */
+		TMap<FName, FName> OutputPinRemap;
+
+		FElementStep() = default;
+
+		explicit FElementStep(const FString& InSettingsClass)
+			: SettingsClass(InSettingsClass)
+		{
+		}
+
+		FElementStep& Set(const FName InProperty, const FString& InValue)
+		{
+			Properties.Add(InProperty, InValue);
+			return *this;
+		}
+
+		FElementStep& Instance(const FName InProperty, const FString& InClass)
+		{
+			InstancedObjects.Add(InProperty, InClass);
+			return *this;
+		}
+
+		FElementStep& Remap(const FName InFrom, const FName InTo)
+		{
+			OutputPinRemap.Add(InFrom, InTo);
+			return *this;
+		}
+	};
+
+	struct PCGEXBENCHMARKS_API FStepResult
+	{
+		bool bSuccess = false;
+		FString Error;
+
+		double Seconds = 0;
+		int64 NumAllocations = 0;
+		int64 AllocatedBytes = 0;
+
+		int32 NumOutputData = 0;
+		int64 NumOutputPoints = 0;
+	};
+
+	/**
+	 * Opt-in GMalloc proxy counting allocations. Installed once, never removed (outstanding allocations
+	 * made through the proxy must be freed through it).
+	 */
+	class PCGEXBENCHMARKS_API FAllocationCounter
+	{
+	public:
+		static bool Install();
+		static bool IsInstalled();
+
+		static int64 GetNumAllocations();
+		static int64 GetAllocatedBytes();
+	};
+
+	class PCGEXBENCHMARKS_API FRunner
+	{
+	public:
+		/** Seconds before an execution that never completes is aborted. */
+		double Timeout = 600;
+
+		/** Instantiates and configures the settings object described by InStep. */
+		UPCGSettings* CreateSettings(UObject* Outer, const FElementStep& InStep, FString& OutError) const;
+
+		/**
+		 * Executes an element to completion on the calling (game) thread, pumping game-thread tasks while the
+		 * element waits on async work. Output data is appended to OutData with OutputPinRemap applied.
+		 */
+		FStepResult Execute(UPCGSettings* InSettings, const FPCGDataCollection& InData, FPCGDataCollection& OutData, const FElementStep* InStep = nullptr) const;
+
+		/** CreateSettings + Execute. */
+		FStepResult Run(UObject* Outer, const FElementStep& InStep, const FPCGDataCollection& InData, FPCGDataCollection& OutData) const;
+
+		static int64 CountPoints(const FPCGDataCollection& InData);
+	};
+}
@@ -0,0 +1,103 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExBenchmarkRunner.h"
+
+class FJsonObject;
+
+namespace PCGExBenchmarks
+{
+	/**
+	 * A benchmark case: synthetic inputs, optional untimed setup steps (e.g build a Delaunay graph before relaxing it),
+	 * and the timed step. Setup outputs are appended to the timed step inputs.
+	 */
+	struct PCGEXBENCHMARKS_API FBenchmarkCase
+	{
+		FString Name;
+		FString Description;
+
+		TFunction<void(UObject* Outer, const int32 Size, const int32 Seed, FPCGDataCollection& OutInputs)> MakeInputs;
+		TArray<FElementStep> Setup;
+		FElementStep Timed;
+	};
+
+	struct PCGEXBENCHMARKS_API FBenchmarkOptions
+	{
+		TArray<int32> Tiers = {1000, 10000, 100000};
+		int32 Iterations = 5;
+		int32 WarmupIterations = 1;
+		int32 Seed = 1337;
+		double Timeout = 600;
+
+		/** Run one extra, untimed iteration with task telemetry enabled to attribute time to task groups. */
+		bool bRecordPhases = false;
+
+		/** Comma-separated, case-insensitive substrings matched against case names. Empty runs everything. */
+		FString Filter;
+
+		bool PassesFilter(const FString& InName) const;
+
+		/** Overrides from command-line style parameters: -Tiers= -Iterations= -Warmup= -Seed= -Timeout= -Filter= -Phases */
+		void ParseParams(const FString& InParams);
+	};
+
+	struct PCGEXBENCHMARKS_API FBenchmarkResult
+	{
+		FString Name;
+		int32 Size = 0;
+
+		bool bSuccess = false;
+		FString Error;
+
+		TArray<double> Samples; // Seconds, one per timed iteration
+		double Median = 0;
+		double Min = 0;
+		double Max = 0;
+		double Mean = 0;
+		double StdDev = 0;
+
+		int64 NumAllocations = -1; // Per iteration median, -1 when allocation counting is not installed
+		int64 AllocatedBytes = -1;
+
+		int32 NumOutputData = 0;
+		int64 NumOutputPoints = 0;
+
+		/** Busy seconds per task group name, summed over all groups sharing that name. Only with bRecordPhases. */
+		TMap<FString, double> Phases;
+
+		/** Unique key of a (case, size) pair, e.g "FusePoints@10000" */
+		FString GetKey() const { return FString::Printf(TEXT("%s@%d"), *Name, Size); }
+
+		void ComputeStats();
+
+		TSharedRef<FJsonObject> ToJson() const;
+		static bool FromJson(const TSharedPtr<FJsonObject>& InObject, FBenchmarkResult& OutResult);
+	};
+
+	/** Built-in cases covering the main element families. */
+	PCGEXBENCHMARKS_API const TArray<FBenchmarkCase>& GetBuiltinCases();
+
+	PCGEXBENCHMARKS_API FBenchmarkResult RunCase(const FBenchmarkCase& InCase, const int32 InSize, const FBenchmarkOptions& InOptions);
+
+	/**
+	 * Single untimed execution of the case (setup included), for output checks rather than timings.
+	 * OnOutputs is called with the timed step outputs before anything is released.
+	 */
+	PCGEXBENCHMARKS_API bool ExecuteCase(const FBenchmarkCase& InCase, const int32 InSize, const FBenchmarkOptions& InOptions, TFunctionRef<void(const FPCGDataCollection& InOutputs)>&& OnOutputs, FString& OutError);
+
+	PCGEXBENCHMARKS_API void RunCases(const TArray<FBenchmarkCase>& InCases, const FBenchmarkOptions& InOptions, TArray<FBenchmarkResult>& OutResults);
+
+	/** Bumped whenever the results layout changes in a way older readers cannot handle. */
+	constexpr int32 ResultsVersion = 1;
+
+	/** InMetadata is stored as-is alongside engine/platform info, e.g revision or manifest name. */
+	PCGEXBENCHMARKS_API bool WriteResultsJson(const FString& InFilePath, const TArray<FBenchmarkResult>& InResults, const FBenchmarkOptions& InOptions, const TMap<FString, FString>& InMetadata = {});
+	PCGEXBENCHMARKS_API bool ReadResultsJson(const FString& InFilePath, TArray<FBenchmarkResult>& OutResults, TMap<FString, FString>* OutMetadata = nullptr);
+	PCGEXBENCHMARKS_API bool WriteResultsCSV(const FString& InFilePath, const TArray<FBenchmarkResult>& InResults);
+
+	/** Human-readable table, one line per result. */
+	PCGEXBENCHMARKS_API void LogResults(const TArray<FBenchmarkResult>& InResults);
+}
@@ -0,0 +1,16 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEditorModuleInterface.h"
+
+class FPCGExBenchmarksModule final : public IPCGExEditorModuleInterface
+{
+	PCGEX_MODULE_BODY
+
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -0,0 +1,37 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Process-wide execution modes used to check that every code path of an element produces the same output.
+ * A mode flips global switches (core settings cache, forced single-threading) on Enter and restores them on Exit.
+ */
+namespace PCGExBenchmarks::ExecutionModes
+{
+	struct PCGEXBENCHMARKS_API FExecutionMode
+	{
+		FString Name;
+		FString Description;
+		TFunction<void()> Enter;
+		TFunction<void()> Exit;
+	};
+
+	/** The first mode is the reference every other mode is compared against. */
+	PCGEXBENCHMARKS_API const TArray<FExecutionMode>& GetBuiltinModes();
+
+	/** Comma-separated, case-insensitive exact names. Empty keeps every mode; the reference mode is always kept first. */
+	PCGEXBENCHMARKS_API void GetModes(const FString& InNames, TArray<FExecutionMode>& OutModes);
+
+	/** Enters a mode for the lifetime of the scope. */
+	class PCGEXBENCHMARKS_API FScopedMode
+	{
+		const FExecutionMode& Mode;
+
+	public:
+		explicit FScopedMode(const FExecutionMode& InMode);
+		~FScopedMode();
+	};
+}
@@ -0,0 +1,42 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPCGBasePointData;
+
+/**
+ * Deterministic synthetic inputs for headless benchmarks.
+ * Every generator is driven by an explicit seed, so the same (size, seed) pair always produces byte-identical data.
+ */
+namespace PCGExBenchmarks::SyntheticData
+{
+	/** Points uniformly distributed inside Bounds. */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeUniformPoints(UObject* Outer, const int32 NumPoints, const FBox& Bounds, const int32 Seed);
+
+	/** Points distributed in NumClusters gaussian-ish blobs of the given radius, blob centers uniformly placed inside Bounds. */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeClusteredPoints(UObject* Outer, const int32 NumPoints, const int32 NumClusters, const double Radius, const FBox& Bounds, const int32 Seed);
+
+	/** Regular 2D grid on the XY plane, NumPoints is rounded up to the next square. Small jitter avoids degenerate co-circular sites. */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeGridPoints(UObject* Outer, const int32 NumPoints, const double Spacing, const double Jitter, const int32 Seed);
+
+	/** Ordered path produced by a random walk on the XY plane. */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeRandomWalkPath(UObject* Outer, const int32 NumPoints, const double StepSize, const int32 Seed);
+
+	/** Ordered path sampled from a random closed or open spline (no spline component required). */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeSplinePath(UObject* Outer, const int32 NumPoints, const int32 NumControlPoints, const FBox& Bounds, const bool bClosedLoop, const int32 Seed);
+
+	/** Adds an int32 attribute whose values are drawn from [0, Cardinality). */
+	PCGEXBENCHMARKS_API void AddIntColumn(UPCGBasePointData* InData, const FName Name, const int32 Cardinality, const int32 Seed);
+
+	/** Adds a double attribute whose values are uniformly drawn from [Min, Max]. */
+	PCGEXBENCHMARKS_API void AddDoubleColumn(UPCGBasePointData* InData, const FName Name, const double Min, const double Max, const int32 Seed);
+
+	/** Adds an FName attribute with Cardinality distinct values ("Value_0", "Value_1", ...). */
+	PCGEXBENCHMARKS_API void AddNameColumn(UPCGBasePointData* InData, const FName Name, const int32 Cardinality, const int32 Seed);
+
+	/** Selects a subset of points from InData (every Nth point, deterministic). Useful for seeds/goals. */
+	PCGEXBENCHMARKS_API UPCGBasePointData* MakeSubset(UObject* Outer, const UPCGBasePointData* InData, const int32 NumPoints, const int32 Seed);
+}
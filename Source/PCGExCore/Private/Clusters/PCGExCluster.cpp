@@ -5,6 +5,7 @@
 #include "Clusters/PCGExClusterCache.h"
 
 #include "Clusters/PCGExClusterCommon.h"
+#include "Clusters/PCGExEdgeBVH.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
@@ -47,6 +48,12 @@ namespace PCGExClusters
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
 
+		// Same edges, same positions; the BVH only depends on those
+		if (const TSharedPtr<FEdgeBVH> EdgeBVH = OriginalCluster->GetCachedData<FEdgeBVH>(FEdgeBVH::CacheKey))
+		{
+			CachedData.Add(FEdgeBVH::CacheKey, EdgeBVH);
+		}
+
 		if (bCopyNodes)
 		{
 			const int32 NumNewNodes = OriginalCluster->Nodes->Num();
@@ -139,6 +146,8 @@ namespace PCGExClusters
 
 	void FCluster::WillModifyVtxPositions(const bool bClearOwned)
 	{
+		bNodeOctreeReady = 0;
+		bEdgeOctreeReady = 0;
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
 		BoundedEdges.Reset();
@@ -421,7 +430,11 @@ namespace PCGExClusters
 
 	TSharedPtr<PCGExOctree::FItemOctree> FCluster::GetNodeOctree()
 	{
-		if (!NodeOctree)
+		if (FPlatformAtomics::AtomicRead(&bNodeOctreeReady)) { return NodeOctree; }
+
+		// Consumers may query from parallel loops; only one of them gets to build
+		FScopeLock Lock(&OctreeLock);
+		if (!bNodeOctreeReady)
 		{
 			RebuildNodeOctree();
 		}
@@ -430,7 +443,10 @@ namespace PCGExClusters
 
 	TSharedPtr<PCGExOctree::FItemOctree> FCluster::GetEdgeOctree()
 	{
-		if (!EdgeOctree)
+		if (FPlatformAtomics::AtomicRead(&bEdgeOctreeReady)) { return EdgeOctree; }
+
+		FScopeLock Lock(&OctreeLock);
+		if (!bEdgeOctreeReady)
 		{
 			RebuildEdgeOctree();
 		}
@@ -448,6 +464,9 @@ namespace PCGExClusters
 			const PCGExData::FConstPoint Pt = PCGExData::FConstPoint(VtxPoints, Node->PointIndex);
 			NodeOctree->AddElement(PCGExOctree::FItem(Node->Index, FBoxSphereBounds(Pt.GetLocalBounds().TransformBy(Pt.GetTransform()))));
 		}
+
+		// Publish only once fully built, for the lock-free path in GetNodeOctree
+		FPlatformAtomics::InterlockedExchange(&bNodeOctreeReady, 1);
 	}
 
 	void FCluster::RebuildEdgeOctree()
@@ -482,10 +501,13 @@ namespace PCGExClusters
 				EdgeOctree->AddElement(PCGExOctree::FItem(i, (BoundedEdgesDataPtr + i)->Bounds));
 			}
 		}
+
+		FPlatformAtomics::InterlockedExchange(&bEdgeOctreeReady, 1);
 	}
 
 	void FCluster::RebuildOctree(const EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild)
 	{
+		FScopeLock Lock(&OctreeLock);
 		switch (Mode)
 		{
 		case EPCGExClusterClosestSearchMode::Vtx:
@@ -496,6 +518,11 @@ namespace PCGExClusters
 			RebuildNodeOctree();
 			break;
 		case EPCGExClusterClosestSearchMode::Edge:
+			// Closest-edge queries build the segment BVH lazily (GetEdgeBVH); only refresh one that already exists
+			if (bForceRebuild && GetCachedData<FEdgeBVH>(FEdgeBVH::CacheKey))
+			{
+				SetCachedData(FEdgeBVH::CacheKey, MakeShared<FEdgeBVH>(this));
+			}
 			if (EdgeOctree && !bForceRebuild)
 			{
 				return;
@@ -583,72 +610,58 @@ namespace PCGExClusters
 
 	int32 FCluster::FindClosestNodeFromEdge(const FVector& Position, const int32 MinNeighbors) const
 	{
-		double MaxDistance = TNumericLimits<double>::Max();
-		int32 ClosestIndex = -1;
-
-		if (EdgeOctree)
-		{
-			auto ProcessCandidate = [&](const PCGExOctree::FItem& Item)
-			{
-				const double Dist = GetPointDistToEdgeSquared(Item.Index, Position);
-				if (Dist < MaxDistance)
-				{
-					if (MinNeighbors > 0 && !EdgeHasMinNeighbors(Item.Index, MinNeighbors))
-					{
-						return;
-					}
-					MaxDistance = Dist;
-					ClosestIndex = Item.Index;
-				}
-			};
-
-			EdgeOctree->FindNearbyElements(Position, ProcessCandidate);
-		}
-		else if (BoundedEdges)
-		{
-			for (const FBoundedEdge& Edge : (*BoundedEdges))
-			{
-				const double Dist = GetPointDistToEdgeSquared(Edge.Index, Position);
-				if (Dist < MaxDistance)
-				{
-					if (MinNeighbors > 0 && !EdgeHasMinNeighbors(Edge.Index, MinNeighbors))
-					{
-						continue;
-					}
-					MaxDistance = Dist;
-					ClosestIndex = Edge.Index;
-				}
-			}
-		}
-		else
-		{
-			for (const FEdge& Edge : (*Edges))
-			{
-				const double Dist = GetPointDistToEdgeSquared(Edge, Position);
-				if (Dist < MaxDistance)
-				{
-					if (MinNeighbors > 0 && !EdgeHasMinNeighbors(Edge.Index, MinNeighbors))
-					{
-						continue;
-					}
-					MaxDistance = Dist;
-					ClosestIndex = Edge.Index;
-				}
-			}
-		}
-
-		if (ClosestIndex == -1)
+		const int32 ClosestEdge = FindClosestEdge(Position, MinNeighbors);
+		if (ClosestEdge == -1)
 		{
 			return -1;
 		}
 
-		const FEdge* Edge = GetEdge(ClosestIndex);
+		const FEdge* Edge = GetEdge(ClosestEdge);
 		const FNode* Start = GetEdgeStart(Edge);
 		const FNode* End = GetEdgeEnd(Edge);
 
-		ClosestIndex = FVector::DistSquared(Position, GetPos(Start)) < FVector::DistSquared(Position, GetPos(End)) ? Start->Index : End->Index;
+		return FVector::DistSquared(Position, GetPos(Start)) < FVector::DistSquared(Position, GetPos(End)) ? Start->Index : End->Index;
+	}
 
-		return ClosestIndex;
+	int32 FCluster::FindClosestEdge(const FVector& Position, const int32 MinNeighbors) const
+	{
+		// Segment BVH rather than the edge octree: octree culling relies on per-edge bounding boxes, which
+		// long diagonal edges blow up, and only looks at octree nodes around the query point.
+		const TSharedPtr<FEdgeBVH> BVH = GetEdgeBVH();
+
+		double DistSquared = 0;
+		if (MinNeighbors <= 0) { return BVH->FindClosestEdge(Position, DistSquared); }
+
+		return BVH->FindClosestEdge(Position, DistSquared, [&](const int32 EdgeIndex) { return EdgeHasMinNeighbors(EdgeIndex, MinNeighbors); });
+	}
+
+	void FCluster::FindClosestNodesFromEdge(TConstArrayView<FVector> Positions, TArray<int32>& OutNodes, const int32 MinNeighbors) const
+	{
+		GetEdgeBVH()->FindClosestEdges(Positions, OutNodes, this, MinNeighbors);
+
+		for (int i = 0; i < Positions.Num(); i++)
+		{
+			if (OutNodes[i] == -1) { continue; }
+
+			const FEdge* Edge = GetEdge(OutNodes[i]);
+			const FNode* Start = GetEdgeStart(Edge);
+			const FNode* End = GetEdgeEnd(Edge);
+
+			OutNodes[i] = FVector::DistSquared(Positions[i], GetPos(Start)) < FVector::DistSquared(Positions[i], GetPos(End)) ? Start->Index : End->Index;
+		}
+	}
+
+	TSharedPtr<FEdgeBVH> FCluster::GetEdgeBVH() const
+	{
+		if (TSharedPtr<FEdgeBVH> Cached = GetCachedData<FEdgeBVH>(FEdgeBVH::CacheKey)) { return Cached; }
+
+		// Serialize builds so concurrent first queries don't each build their own tree
+		FScopeLock BuildLock(&EdgeBVHLock);
+		if (TSharedPtr<FEdgeBVH> Cached = GetCachedData<FEdgeBVH>(FEdgeBVH::CacheKey)) { return Cached; }
+
+		TSharedPtr<FEdgeBVH> BVH = MakeShared<FEdgeBVH>(this);
+		const_cast<FCluster*>(this)->SetCachedData(FEdgeBVH::CacheKey, BVH);
+		return BVH;
 	}
 
 	int32 FCluster::FindClosestEdge(const int32 InNodeIndex, const FVector& InPosition, const int32 MinNeighbors) const
@@ -1013,6 +1026,106 @@ namespace PCGExClusters
 		OutValidEdges.Shrink();
 	}
 
+	bool FCluster::AreValidEdgesConnected() const
+	{
+		const int32 NumNodes = Nodes->Num();
+		if (NumNodes == 0) { return false; }
+
+		TBitArray<> Visited;
+		Visited.Init(false, NumNodes);
+
+		TArray<int32> Stack;
+		Stack.Reserve(NumNodes);
+		Stack.Add(0);
+		Visited[0] = true;
+
+		int32 NumVisited = 1;
+
+		while (!Stack.IsEmpty())
+		{
+			const FNode* Node = NodesDataPtr + Stack.Pop(EAllowShrinking::No);
+			for (const FLink Lk : Node->Links)
+			{
+				if (Visited[Lk.Node] || !IsEdgeFullyValid(*(EdgesDataPtr + Lk.Edge))) { continue; }
+				Visited[Lk.Node] = true;
+				Stack.Add(Lk.Node);
+				NumVisited++;
+			}
+		}
+
+		return NumVisited == NumNodes;
+	}
+
+	bool FCluster::CompactEdges(TBitArray<>& OutEdgeMask)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::CompactEdges);
+
+		const TArray<FEdge>& OldEdges = *Edges;
+		const int32 NumOldEdges = OldEdges.Num();
+
+		TArray<int32> Remap;
+		Remap.SetNumUninitialized(NumOldEdges);
+		OutEdgeMask.Init(false, NumOldEdges);
+
+		int32 NumKept = 0;
+		for (int i = 0; i < NumOldEdges; i++)
+		{
+			if (IsEdgeFullyValid(OldEdges[i]))
+			{
+				Remap[i] = NumKept++;
+				OutEdgeMask[i] = true;
+			}
+			else
+			{
+				Remap[i] = -1;
+			}
+		}
+
+		TSharedPtr<TArray<FNode>> NewNodes = MakeShared<TArray<FNode>>(*Nodes);
+		for (FNode& Node : *NewNodes)
+		{
+			Node.Links.RemoveAll([&](const FLink& Lk) { return Remap[Lk.Edge] == -1; });
+			if (Node.Links.IsEmpty())
+			{
+				OutEdgeMask.Reset();
+				return false;
+			}
+
+			for (FLink& Lk : Node.Links) { Lk.Edge = Remap[Lk.Edge]; }
+			Node.bValid = true;
+		}
+
+		TSharedPtr<TArray<FEdge>> NewEdges = MakeShared<TArray<FEdge>>();
+		NewEdges->Reserve(NumKept);
+		for (int i = 0; i < NumOldEdges; i++)
+		{
+			if (Remap[i] == -1) { continue; }
+			FEdge& Edge = NewEdges->Add_GetRef(OldEdges[i]);
+			Edge.Index = Edge.PointIndex = Remap[i];
+			Edge.bValid = true;
+		}
+
+		Nodes = NewNodes;
+		Edges = NewEdges;
+		NodesDataPtr = Nodes->GetData();
+		EdgesDataPtr = Edges->GetData();
+		NumRawEdges = NumKept;
+
+		// Nothing is shared with the source cluster anymore
+		bIsMirror = false;
+		OriginalCluster.Reset();
+
+		// Nodes didn't move, only edge-derived data needs to go
+		bEdgeOctreeReady = 0;
+		EdgeOctree.Reset();
+		BoundedEdges.Reset();
+		EdgeLengths.Reset();
+		bEdgeLengthsDirty = true;
+		ClearCachedData();
+
+		return true;
+	}
+
 	int32 FCluster::FindClosestNeighborInDirection(const int32 NodeIndex, const FVector& Direction, const int32 MinNeighborCount) const
 	{
 		const TArray<FNode>& NodesRef = *Nodes;
@@ -0,0 +1,364 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterDiskCache.h"
+
+#include "PCGExH.h"
+#include "PCGExLog.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCommon.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PCGExClusters::DiskCache
+{
+	static bool GDiskCacheEnabled = false;
+	static FAutoConsoleVariableRef CVarDiskCacheEnabled(
+		TEXT("pcgex.Clusters.DiskCache"),
+		GDiskCacheEnabled,
+		TEXT("Persist cluster topology to Saved/PCGEx/ClusterCache and reuse it when vtx/edges content matches."));
+
+	static int32 GDiskCacheMaxSizeMB = 512;
+	static FAutoConsoleVariableRef CVarDiskCacheMaxSizeMB(
+		TEXT("pcgex.Clusters.DiskCache.MaxSizeMB"),
+		GDiskCacheMaxSizeMB,
+		TEXT("Size limit of the cluster disk cache. Least recently used entries are evicted past this. <= 0 disables the limit."));
+
+	static bool GDiskCacheValidate = false;
+	static FAutoConsoleVariableRef CVarDiskCacheValidate(
+		TEXT("pcgex.Clusters.DiskCache.Validate"),
+		GDiskCacheValidate,
+		TEXT("Always build clusters, and cross-check disk cache entries against the fresh build. Mismatching entries are replaced."));
+
+	static FAutoConsoleCommand CommandDiskCacheClear(
+		TEXT("pcgex.Clusters.DiskCache.Clear"),
+		TEXT("Deletes every cluster disk cache entry."),
+		FConsoleCommandDelegate::CreateLambda([]() { Clear(); }));
+
+	namespace
+	{
+		constexpr uint32 Magic = 0x43584350; // "PCXC"
+		const TCHAR* Extension = TEXT(".pcgexc");
+
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint64 Key = 0;
+			int32 NumRawVtx = 0;
+			int32 NumRawEdges = 0;
+			int32 NumNodes = 0;
+
+			friend FArchive& operator<<(FArchive& Ar, FHeader& H)
+			{
+				Ar << H.Magic << H.Version << H.Key << H.NumRawVtx << H.NumRawEdges << H.NumNodes;
+				return Ar;
+			}
+		};
+
+		FCriticalSection SizeLock;
+		int64 KnownBytes = -1; // Lazily initialized from a directory scan
+
+		FString GetEntryPath(const uint64 InKey)
+		{
+			return FPaths::Combine(GetCacheDirectory(), FString::Printf(TEXT("%016llx%s"), InKey, Extension));
+		}
+
+		int64 EvictUnsafe(const int64 InMaxBytes)
+		{
+			struct FEntry
+			{
+				FString Path;
+				FDateTime Time;
+				int64 Size = 0;
+			};
+
+			TArray<FEntry> Entries;
+			int64 TotalBytes = 0;
+
+			IFileManager::Get().IterateDirectoryStat(
+				*GetCacheDirectory(), [&](const TCHAR* InPath, const FFileStatData& InStat)
+				{
+					if (!InStat.bIsDirectory && FStringView(InPath).EndsWith(Extension))
+					{
+						Entries.Add({InPath, InStat.ModificationTime, InStat.FileSize});
+						TotalBytes += InStat.FileSize;
+					}
+					return true;
+				});
+
+			if (InMaxBytes < 0 || TotalBytes <= InMaxBytes) { return TotalBytes; }
+
+			// Loads touch their entry, so modification time is last use
+			Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Time < B.Time; });
+
+			for (const FEntry& Entry : Entries)
+			{
+				if (TotalBytes <= InMaxBytes) { break; }
+				if (IFileManager::Get().Delete(*Entry.Path, false, false, true)) { TotalBytes -= Entry.Size; }
+			}
+
+			return TotalBytes;
+		}
+
+		void OnStored(const int64 InBytes)
+		{
+			const int64 MaxBytes = static_cast<int64>(GDiskCacheMaxSizeMB) * 1024 * 1024;
+			if (MaxBytes <= 0) { return; }
+
+			FScopeLock Lock(&SizeLock);
+
+			if (KnownBytes < 0) { KnownBytes = EvictUnsafe(-1); }
+			else { KnownBytes += InBytes; }
+
+			// Evict down to 90% so that every store past the limit doesn't rescan the directory
+			if (KnownBytes > MaxBytes) { KnownBytes = EvictUnsafe(MaxBytes - MaxBytes / 10); }
+		}
+	}
+
+	bool IsEnabled() { return GDiskCacheEnabled; }
+	bool IsValidating() { return GDiskCacheValidate; }
+
+	FString GetCacheDirectory()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("ClusterCache"));
+	}
+
+	uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::ComputeKey);
+
+		// Topology only depends on the endpoint hashes; positions are deliberately left out
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> VtxBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(InVtxIO, Labels::Attr_PCGExVtxIdx);
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> EdgeBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(InEdgesIO, Labels::Attr_PCGExEdgeIdx);
+		if (!VtxBuffer->InitForRead() || !EdgeBuffer->InitForRead()) { return 0; }
+
+		const TArray<int64>& VtxValues = *VtxBuffer->GetInValues().Get();
+		const TArray<int64>& EdgeValues = *EdgeBuffer->GetInValues().Get();
+
+		uint64 Key = PCGEx::H64U(VtxValues.Num(), EdgeValues.Num()) ^ (static_cast<uint64>(FormatVersion) << 56);
+		Key = CityHash64WithSeed(reinterpret_cast<const char*>(VtxValues.GetData()), VtxValues.Num() * sizeof(int64), Key);
+		Key = CityHash64WithSeed(reinterpret_cast<const char*>(EdgeValues.GetData()), EdgeValues.Num() * sizeof(int64), Key);
+
+		return Key ? Key : 1;
+	}
+
+	bool Load(FCluster& InCluster, const uint64 InKey)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::Load);
+
+		const TSharedPtr<PCGExData::FPointIO> VtxIO = InCluster.VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> EdgesIO = InCluster.EdgesIO.Pin();
+		if (!VtxIO || !EdgesIO || !InCluster.NodeIndexLookup) { return false; }
+
+		const FString Path = GetEntryPath(InKey);
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent)) { return false; }
+
+		FMemoryReader Ar(Bytes);
+
+		TArray<FNode>& Nodes = *InCluster.Nodes;
+		TArray<FEdge>& Edges = *InCluster.Edges;
+
+		auto OnFail = [&]()
+		{
+			for (const FNode& Node : Nodes) { InCluster.NodeIndexLookup->Set(Node.PointIndex, -1); }
+			Nodes.Empty();
+			Edges.Empty();
+			InCluster.Bounds = FBox(ForceInit);
+
+			UE_LOG(LogPCGEx, Verbose, TEXT("PCGEx cluster disk cache: discarding invalid entry %s"), *Path);
+			IFileManager::Get().Delete(*Path, false, false, true);
+			return false;
+		};
+
+		FHeader Header;
+		Ar << Header;
+
+		const int32 NumRawVtx = VtxIO->GetNum();
+		const int32 NumEdges = EdgesIO->GetNum();
+
+		if (Ar.IsError() || Header.Magic != Magic || Header.Version != FormatVersion || Header.Key != InKey ||
+			Header.NumRawVtx != NumRawVtx || Header.NumRawEdges != NumEdges ||
+			Header.NumNodes < 0 || Header.NumNodes > NumRawVtx)
+		{
+			return OnFail();
+		}
+
+		const UPCGBasePointData* InNodePoints = VtxIO->GetIn();
+		InCluster.VtxTransforms = InNodePoints->GetConstTransformValueRange();
+		InCluster.NumRawVtx = NumRawVtx;
+		InCluster.NumRawEdges = NumEdges;
+		InCluster.Bounds = FBox(ForceInit);
+
+		const int32 EdgeIOIndex = EdgesIO->IOIndex;
+
+		Edges.SetNumUninitialized(NumEdges);
+		for (int i = 0; i < NumEdges; i++)
+		{
+			uint32 Start = 0;
+			uint32 End = 0;
+			Ar << Start << End;
+
+			if (Start >= static_cast<uint32>(NumRawVtx) || End >= static_cast<uint32>(NumRawVtx)) { return OnFail(); }
+			Edges[i] = FEdge(i, Start, End, i, EdgeIOIndex);
+		}
+
+		Nodes.Reserve(Header.NumNodes);
+		for (int i = 0; i < Header.NumNodes; i++)
+		{
+			int32 PointIndex = -1;
+			int32 NumLinks = 0;
+			Ar << PointIndex << NumLinks;
+
+			if (Ar.IsError() || PointIndex < 0 || PointIndex >= NumRawVtx || NumLinks < 0 || NumLinks > NumEdges) { return OnFail(); }
+
+			FNode& Node = Nodes.Emplace_GetRef(i, PointIndex);
+			InCluster.NodeIndexLookup->Set(PointIndex, i);
+			InCluster.Bounds += InCluster.VtxTransforms[PointIndex].GetLocation();
+
+			Node.Links.SetNumUninitialized(NumLinks);
+			for (FLink& Lk : Node.Links)
+			{
+				Ar << Lk.Node << Lk.Edge;
+				if (Lk.Node < 0 || Lk.Node >= Header.NumNodes || Lk.Edge < 0 || Lk.Edge >= NumEdges) { return OnFail(); }
+			}
+		}
+
+		if (Ar.IsError()) { return OnFail(); }
+
+		InCluster.Bounds = InCluster.Bounds.ExpandBy(10);
+		InCluster.NodesDataPtr = Nodes.GetData();
+		InCluster.EdgesDataPtr = Edges.GetData();
+
+		// Modification time doubles as last use for LRU eviction
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+
+		return true;
+	}
+
+	bool Store(const FCluster& InCluster, const uint64 InKey)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::Store);
+
+		const TArray<FNode>& Nodes = *InCluster.Nodes;
+		const TArray<FEdge>& Edges = *InCluster.Edges;
+
+		TArray<uint8> Bytes;
+		Bytes.Reserve(sizeof(FHeader) + Edges.Num() * sizeof(uint32) * 2 + Nodes.Num() * sizeof(int32) * 2 + Edges.Num() * 2 * sizeof(FLink));
+
+		FMemoryWriter Ar(Bytes);
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = FormatVersion;
+		Header.Key = InKey;
+		Header.NumRawVtx = InCluster.NumRawVtx;
+		Header.NumRawEdges = InCluster.NumRawEdges;
+		Header.NumNodes = Nodes.Num();
+		Ar << Header;
+
+		for (const FEdge& Edge : Edges)
+		{
+			uint32 Start = Edge.Start;
+			uint32 End = Edge.End;
+			Ar << Start << End;
+		}
+
+		for (const FNode& Node : Nodes)
+		{
+			int32 PointIndex = Node.PointIndex;
+			int32 NumLinks = Node.Links.Num();
+			Ar << PointIndex << NumLinks;
+
+			for (FLink Lk : Node.Links) { Ar << Lk.Node << Lk.Edge; }
+		}
+
+		// Write aside then move, so concurrent readers never see a partial entry
+		const FString Path = GetEntryPath(InKey);
+		const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath)) { return false; }
+		if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return false;
+		}
+
+		OnStored(Bytes.Num());
+		return true;
+	}
+
+	bool HasSameTopology(const FCluster& A, const FCluster& B)
+	{
+		const TArray<FNode>& NodesA = *A.Nodes;
+		const TArray<FNode>& NodesB = *B.Nodes;
+		const TArray<FEdge>& EdgesA = *A.Edges;
+		const TArray<FEdge>& EdgesB = *B.Edges;
+
+		if (NodesA.Num() != NodesB.Num() || EdgesA.Num() != EdgesB.Num()) { return false; }
+
+		for (int i = 0; i < EdgesA.Num(); i++)
+		{
+			if (EdgesA[i].Start != EdgesB[i].Start || EdgesA[i].End != EdgesB[i].End) { return false; }
+		}
+
+		for (int i = 0; i < NodesA.Num(); i++)
+		{
+			if (NodesA[i].PointIndex != NodesB[i].PointIndex || NodesA[i].Links != NodesB[i].Links) { return false; }
+		}
+
+		return true;
+	}
+
+	void Evict(const int64 InMaxBytes)
+	{
+		FScopeLock Lock(&SizeLock);
+		KnownBytes = EvictUnsafe(InMaxBytes);
+	}
+
+	void Clear()
+	{
+		FScopeLock Lock(&SizeLock);
+		IFileManager::Get().DeleteDirectory(*GetCacheDirectory(), false, true);
+		KnownBytes = 0;
+	}
+
+	bool BuildFrom(const TSharedRef<FCluster>& InCluster, const TMap<uint32, int32>& InEndpointsLookup, const TArray<int32>* InExpectedAdjacency)
+	{
+		if (!GDiskCacheEnabled) { return InCluster->BuildFrom(InEndpointsLookup, InExpectedAdjacency); }
+
+		const TSharedPtr<PCGExData::FPointIO> VtxIO = InCluster->VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> EdgesIO = InCluster->EdgesIO.Pin();
+		if (!VtxIO || !EdgesIO) { return InCluster->BuildFrom(InEndpointsLookup, InExpectedAdjacency); }
+
+		const uint64 Key = ComputeKey(VtxIO.ToSharedRef(), EdgesIO.ToSharedRef());
+		if (!Key) { return InCluster->BuildFrom(InEndpointsLookup, InExpectedAdjacency); }
+
+		// A stored entry has already passed the adjacency check, and same content means same outcome
+		if (!GDiskCacheValidate && Load(*InCluster, Key)) { return true; }
+
+		if (!InCluster->BuildFrom(InEndpointsLookup, InExpectedAdjacency)) { return false; }
+
+		if (GDiskCacheValidate)
+		{
+			const TSharedPtr<FCluster> CachedCluster = MakeShared<FCluster>(VtxIO, EdgesIO, MakeShared<PCGEx::FIndexLookup>(VtxIO->GetNum()));
+			if (Load(*CachedCluster, Key))
+			{
+				if (HasSameTopology(*InCluster, *CachedCluster)) { return true; }
+				UE_LOG(LogPCGEx, Warning, TEXT("PCGEx cluster disk cache: entry %016llx does not match a fresh build and will be replaced."), Key);
+			}
+		}
+
+		Store(*InCluster, Key);
+		return true;
+	}
+}
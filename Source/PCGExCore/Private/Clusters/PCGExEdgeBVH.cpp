@@ -0,0 +1,100 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExEdgeBVH.h"
+
+#include "Algo/Sort.h"
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExClusters
+{
+	FEdgeBVH::FEdgeBVH(const FCluster* InCluster)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FEdgeBVH::Build);
+
+		const int32 NumEdges = InCluster->Edges->Num();
+
+		Starts.SetNumUninitialized(NumEdges);
+		Ends.SetNumUninitialized(NumEdges);
+		Order.SetNumUninitialized(NumEdges);
+
+		TArray<FVector> Centers;
+		Centers.SetNumUninitialized(NumEdges);
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FEdge* Edge = InCluster->GetEdge(i);
+			Starts[i] = InCluster->GetStartPos(Edge);
+			Ends[i] = InCluster->GetEndPos(Edge);
+			Centers[i] = (Starts[i] + Ends[i]) * 0.5;
+			Order[i] = i;
+		}
+
+		if (!NumEdges) { return; }
+
+		// A binary tree with leaves of at least LeafSize / 2 edges has fewer than 2 * NumEdges / (LeafSize / 2) nodes
+		Nodes.Reserve(FMath::Max(1, NumEdges * 4 / LeafSize));
+		BuildRecursive(Centers, 0, NumEdges);
+	}
+
+	int32 FEdgeBVH::BuildRecursive(const TArray<FVector>& Centers, const int32 First, const int32 Count)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds(ForceInit);
+		FBox CenterBounds(ForceInit);
+		for (int i = First; i < First + Count; i++)
+		{
+			const int32 EdgeIndex = Order[i];
+			Bounds += Starts[EdgeIndex];
+			Bounds += Ends[EdgeIndex];
+			CenterBounds += Centers[EdgeIndex];
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= LeafSize)
+		{
+			Nodes[NodeIndex].Start = First;
+			Nodes[NodeIndex].Count = Count;
+			return NodeIndex;
+		}
+
+		// Median split along the longest axis of the centers; keeps the tree balanced regardless of distribution
+		const FVector Extent = CenterBounds.GetExtent();
+		const int32 Axis = Extent.X >= Extent.Y && Extent.X >= Extent.Z ? 0 : Extent.Y >= Extent.Z ? 1 : 2;
+
+		Algo::Sort(
+			MakeArrayView(Order.GetData() + First, Count), [&](const int32 A, const int32 B)
+			{
+				return Centers[A][Axis] < Centers[B][Axis];
+			});
+
+		const int32 Half = Count / 2;
+		BuildRecursive(Centers, First, Half);
+		const int32 Right = BuildRecursive(Centers, First + Half, Count - Half);
+
+		// Nodes may have been reallocated by the recursion
+		Nodes[NodeIndex].Start = Right;
+		Nodes[NodeIndex].Count = 0;
+
+		return NodeIndex;
+	}
+
+	void FEdgeBVH::FindClosestEdges(TConstArrayView<FVector> Positions, TArray<int32>& OutEdges, const FCluster* InCluster, const int32 MinNeighbors) const
+	{
+		OutEdges.SetNumUninitialized(Positions.Num());
+
+		const bool bFilter = InCluster && MinNeighbors > 0;
+
+		PCGExMT::ParallelOrSequential(
+			Positions.Num(), [&](const int32 i)
+			{
+				double DistSquared = 0;
+				OutEdges[i] = bFilter
+					              ? FindClosestEdge(Positions[i], DistSquared, [&](const int32 EdgeIndex) { return InCluster->EdgeHasMinNeighbors(EdgeIndex, MinNeighbors); })
+					              : FindClosestEdge(Positions[i], DistSquared);
+			}, 64);
+	}
+}
@@ -0,0 +1,112 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Containers/PCGExUnionFind.h"
+
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGEx
+{
+	FUnionFind::FUnionFind(const int32 InNum)
+	{
+		Parent.SetNumUninitialized(InNum);
+		int32* ParentData = Parent.GetData();
+		PCGExMT::ParallelOrSequential(InNum, [ParentData](const int32 i) { ParentData[i] = i; });
+	}
+
+	int32 FUnionFind::Find(int32 X)
+	{
+		int32* ParentData = Parent.GetData();
+
+		// Parents only ever move toward smaller indices; a stale relaxed read is still a valid ancestor
+		// and the chase converges regardless of thread interleaving.
+		while (true)
+		{
+			const int32 P = FPlatformAtomics::AtomicRead_Relaxed(ParentData + X);
+			if (P == X) { return X; }
+
+			const int32 GP = FPlatformAtomics::AtomicRead_Relaxed(ParentData + P);
+			if (GP == P) { return P; }
+
+			// Halving is opportunistic; a failed exchange means another thread already moved this link further along.
+			FPlatformAtomics::InterlockedCompareExchange(ParentData + X, GP, P);
+			X = GP;
+		}
+	}
+
+	bool FUnionFind::Union(int32 A, int32 B)
+	{
+		int32* ParentData = Parent.GetData();
+
+		while (true)
+		{
+			A = Find(A);
+			B = Find(B);
+
+			if (A == B) { return false; }
+			if (A > B) { Swap(A, B); }
+
+			// Only valid if B is still its own root, otherwise retry from the new roots
+			if (FPlatformAtomics::InterlockedCompareExchange(ParentData + B, A, B) == B) { return true; }
+		}
+	}
+
+	void FUnionFind::Flatten()
+	{
+		int32* ParentData = Parent.GetData();
+		PCGExMT::ParallelOrSequential(
+			Parent.Num(), [&](const int32 i)
+			{
+				FPlatformAtomics::InterlockedExchange(ParentData + i, Find(i));
+			});
+	}
+
+	int32 FUnionFind::Label(TArray<int32>& OutLabels, TConstArrayView<int8> InIncluded) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionFind::Label);
+
+		const int32 NumElements = Parent.Num();
+		const bool bMasked = !InIncluded.IsEmpty();
+		check(!bMasked || InIncluded.Num() == NumElements)
+
+		OutLabels.SetNumUninitialized(NumElements);
+
+		// Roots are set minimums, so numbering roots in index order yields ids ordered by minimum element.
+		// Chunked count -> scan -> fill, so the numbering is parallel yet deterministic.
+		constexpr int32 ChunkSize = 16384;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumElements, ChunkSize);
+
+		TArray<int32> ChunkOffsets;
+		ChunkOffsets.SetNumZeroed(NumChunks + 1);
+
+		auto IsLabeledRoot = [&](const int32 i) { return Parent[i] == i && (!bMasked || InIncluded[i]); };
+
+		PCGExMT::ParallelOrSequential(
+			NumChunks, [&](const int32 c)
+			{
+				const int32 End = FMath::Min(NumElements, (c + 1) * ChunkSize);
+				int32 Count = 0;
+				for (int32 i = c * ChunkSize; i < End; i++) { Count += IsLabeledRoot(i); }
+				ChunkOffsets[c + 1] = Count;
+			}, 2);
+
+		for (int32 c = 0; c < NumChunks; c++) { ChunkOffsets[c + 1] += ChunkOffsets[c]; }
+
+		PCGExMT::ParallelOrSequential(
+			NumChunks, [&](const int32 c)
+			{
+				const int32 End = FMath::Min(NumElements, (c + 1) * ChunkSize);
+				int32 Next = ChunkOffsets[c];
+				for (int32 i = c * ChunkSize; i < End; i++) { OutLabels[i] = IsLabeledRoot(i) ? Next++ : -1; }
+			}, 2);
+
+		// Roots are labeled above and never rewritten, so members can read them concurrently
+		PCGExMT::ParallelOrSequential(
+			NumElements, [&](const int32 i)
+			{
+				if (Parent[i] != i) { OutLabels[i] = (!bMasked || InIncluded[i]) ? OutLabels[Parent[i]] : -1; }
+			});
+
+		return ChunkOffsets[NumChunks];
+	}
+}
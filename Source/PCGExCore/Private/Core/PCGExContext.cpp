@@ -654,7 +654,7 @@ bool FPCGExContext::CancelExecution(const FString& InReason)
 				[Finalizer = MakeShared<PCGExContextFinalize::FGameThreadFinalizer>(KeepAlive, AsyncPinTracker)]()
 				{
 					PCGExContextFinalize::FGameThreadFinalizer::ScheduleNextPoll(Finalizer);
-				});
+				}, PCGExMT::MainThread::EPriority::High);
 		}
 
 		OutputData.Reset();
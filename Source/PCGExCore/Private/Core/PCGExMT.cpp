@@ -11,6 +11,7 @@
 #include "UObject/GarbageCollection.h"
 #include "UObject/UObjectGlobals.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExMTTelemetry.h"
 #include "Core/PCGExSettings.h"
 #include "HAL/PlatformTime.h"
 #include "Misc/ScopeRWLock.h"
@@ -379,6 +380,14 @@ namespace PCGExMT
 		}
 	}
 
+	void IAsyncHandleGroup::RecordScopes(const int32 Count) const
+	{
+		if (TelemetryRecord)
+		{
+			TelemetryRecord->AddScopes(Count);
+		}
+	}
+
 	bool IAsyncHandleGroup::IsAvailable() const
 	{
 		if (IsCancelled() || GetState() == EAsyncHandleState::Ended)
@@ -442,6 +451,11 @@ namespace PCGExMT
 		// Clear registry to free memory
 		ClearRegistry();
 
+		if (TelemetryRecord)
+		{
+			TelemetryRecord->OnEnd(bWasCancelled);
+		}
+
 		if (!bWasCancelled && OnCompleteCallback)
 		{
 			FCompletionCallback LocalCallback = MoveTemp(OnCompleteCallback);
@@ -494,10 +508,20 @@ namespace PCGExMT
 		  , ContextHandle(InContext->GetWeakSelfHandle())
 	{
 		WorkHandle = Context->GetWorkHandle();
+
+		if (Telemetry::IsEnabled())
+		{
+			ExecutionTelemetry = MakeShared<Telemetry::FExecutionRecord>(InContext);
+			TelemetryRecord = ExecutionTelemetry->AddGroup(GroupName);
+		}
 	}
 
 	FTaskManager::~FTaskManager()
 	{
+		if (ExecutionTelemetry)
+		{
+			Telemetry::FRegistry::Get().Submit(ExecutionTelemetry);
+		}
 	}
 
 	FTaskManager* FTaskManager::GetManager() const
@@ -633,6 +657,12 @@ namespace PCGExMT
 
 		NewGroup->HandleIdx = Idx * -1;
 
+		if (ExecutionTelemetry)
+		{
+			const TSharedPtr<Telemetry::FGroupRecord>& ParentRecord = InParentHandle ? InParentHandle->TelemetryRecord : TelemetryRecord;
+			NewGroup->TelemetryRecord = ExecutionTelemetry->AddGroup(InName, ParentRecord ? ParentRecord->GetIndex() : -1);
+		}
+
 		PCGEX_SHARED_THIS_DECL
 		if (NewGroup->SetGroup(InParentHandle ? InParentHandle : ThisPtr))
 		{
@@ -680,7 +710,16 @@ namespace PCGExMT
 			InTask->SetGroup(ThisPtr);
 		}
 
-		UE::Tasks::Launch(*InTask->DEBUG_HandleId(), [WeakManager = TWeakPtr<FTaskManager>(SharedThis(this)), Task = InTask, PinTracker = Context->GetAsyncPinTracker()]()
+		// Telemetry is attributed to the task's owning group; launch time is captured here to measure queueing delay.
+		TSharedPtr<Telemetry::FGroupRecord> Record = nullptr;
+		double LaunchedAt = 0;
+		if (ExecutionTelemetry)
+		{
+			if (const TSharedPtr<IAsyncHandleGroup> TaskGroup = InTask->Group.Pin()) { Record = TaskGroup->TelemetryRecord; }
+			LaunchedAt = FPlatformTime::Seconds();
+		}
+
+		UE::Tasks::Launch(*InTask->DEBUG_HandleId(), [WeakManager = TWeakPtr<FTaskManager>(SharedThis(this)), Task = InTask, PinTracker = Context->GetAsyncPinTracker(), Record, LaunchedAt]()
 		{
 #define PCGEX_CANCEL_TASK_INTERNAL Task->Cancel(); Task->Complete(); return;
 
@@ -709,7 +748,12 @@ namespace PCGExMT
 
 				if (Task->Start())
 				{
+					const double StartedAt = Record ? FPlatformTime::Seconds() : 0;
+					if (Record) { Record->OnTaskStart(LaunchedAt, StartedAt); }
+
 					Task->ExecuteTask(Manager);
+
+					if (Record) { Record->OnTaskEnd(StartedAt, FPlatformTime::Seconds()); }
 					Task->Complete();
 				}
 			}
@@ -724,6 +768,11 @@ namespace PCGExMT
 		// Clear registries
 		ClearRegistry();
 
+		if (TelemetryRecord)
+		{
+			TelemetryRecord->OnEnd(bWasCancelled);
+		}
+
 		// For the manager, we DON'T call parent notification (there is no parent)
 		// We call OnEndCallback directly, which notifies the context
 
@@ -819,7 +868,7 @@ namespace PCGExMT
 
 		const int32 SanitizedChunk = GetSanitizedBatchSize(NumIterations, ChunkSize);
 
-		if (bForceSingleThreaded)
+		if (bForceSingleThreaded || IsForcedSingleThreaded())
 		{
 			TArray<FScope> Loops;
 			const int32 NumScopes = SubLoopScopes(Loops, NumIterations, SanitizedChunk);
@@ -828,6 +877,8 @@ namespace PCGExMT
 				FRegistrationGuard Guard(SharedThis(this));
 
 				RegisterExpected(NumScopes);
+				RecordScopes(NumScopes);
+
 				if (OnPrepareSubLoopsCallback)
 				{
 					OnPrepareSubLoopsCallback(Loops);
@@ -857,6 +908,7 @@ namespace PCGExMT
 				FRegistrationGuard Guard(SharedThis(this));
 
 				RegisterExpected(NumScopes);
+				RecordScopes(NumScopes);
 
 				if (OnPrepareSubLoopsCallback)
 				{
@@ -867,9 +919,24 @@ namespace PCGExMT
 				// Started==Completed invariant holds when the guard destructor fires.
 				StartedCount.fetch_add(NumScopes, std::memory_order_acq_rel);
 
+				// Scopes run synchronously here, so telemetry records them as tasks with no queueing delay.
+				auto TimedScopeIteration = [&](const FScope& InScope)
+				{
+					if (!TelemetryRecord)
+					{
+						ExecScopeIteration(InScope, bPreparationOnly);
+						return;
+					}
+
+					const double StartedAt = FPlatformTime::Seconds();
+					TelemetryRecord->OnTaskStart(StartedAt, StartedAt);
+					ExecScopeIteration(InScope, bPreparationOnly);
+					TelemetryRecord->OnTaskEnd(StartedAt, FPlatformTime::Seconds());
+				};
+
 				if (NumScopes == 1)
 				{
-					ExecScopeIteration(Loops[0], bPreparationOnly);
+					TimedScopeIteration(Loops[0]);
 				}
 				else
 				{
@@ -882,7 +949,7 @@ namespace PCGExMT
 							{
 								return;
 							}
-							ExecScopeIteration(Loops[i], bPreparationOnly);
+							TimedScopeIteration(Loops[i]);
 						},
 						2,                                  // Threshold=2: redundant given the NumScopes==1 branch above, but harmless.
 						EParallelForFlags::Unbalanced);     // Scope cost commonly varies (filtered points, data-dependent inner loops, cluster connectivity).
@@ -956,7 +1023,7 @@ namespace PCGExMT
 		SimpleCallbacks[Index]();
 	}
 
-	void ExecuteOnMainThread(const TSharedPtr<IAsyncHandleGroup>& ParentHandle, FExecuteCallback&& Callback)
+	void ExecuteOnMainThread(const TSharedPtr<IAsyncHandleGroup>& ParentHandle, FExecuteCallback&& Callback, const MainThread::EPriority Priority)
 	{
 		if (IsInGameThread())
 		{
@@ -965,18 +1032,25 @@ namespace PCGExMT
 		}
 
 		TWeakPtr<FAsyncToken> TokenWeakPtr = ParentHandle->TryCreateToken(FName("ExecuteOnMainThread"));
-		AsyncTask(ENamedThreads::GameThread, [TokenWeakPtr, Callback]()
+		TSharedPtr<Telemetry::FGroupRecord> Record = ParentHandle->GetTelemetryRecord();
+		const double QueuedAt = Record ? FPlatformTime::Seconds() : 0;
+
+		MainThread::Enqueue([TokenWeakPtr, Callback = MoveTemp(Callback), Record, QueuedAt]()
 		{
 			if (!TokenWeakPtr.IsValid())
 			{
 				return;
 			}
+
+			const double StartedAt = Record ? FPlatformTime::Seconds() : 0;
 			Callback();
+			if (Record) { Record->OnMainThreadHop(QueuedAt, StartedAt, FPlatformTime::Seconds()); }
+
 			PCGEX_ASYNC_RELEASE_CAPTURED_TOKEN(TokenWeakPtr)
-		});
+		}, Priority);
 	}
 
-	void ExecuteOnMainThread(FExecuteCallback&& Callback)
+	void ExecuteOnMainThread(FExecuteCallback&& Callback, const MainThread::EPriority Priority)
 	{
 		if (IsInGameThread())
 		{
@@ -984,7 +1058,7 @@ namespace PCGExMT
 			return;
 		}
 
-		AsyncTask(ENamedThreads::GameThread, Callback);
+		MainThread::Enqueue([Callback = MoveTemp(Callback)]() { Callback(); }, Priority);
 	}
 
 	bool IsObjectWorkBlocked()
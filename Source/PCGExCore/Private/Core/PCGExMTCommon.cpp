@@ -4,9 +4,22 @@
 #include "Core/PCGExMTCommon.h"
 #include "Async/ParallelFor.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
 
 namespace PCGExMT
 {
+	namespace
+	{
+		bool GForceSingleThreaded = false;
+		FAutoConsoleVariableRef CVarForceSingleThreaded(
+			TEXT("pcgex.MT.ForceSingleThreaded"),
+			GForceSingleThreaded,
+			TEXT("Run every PCGEx parallel loop and task-group iteration on the calling thread."));
+	}
+
+	bool IsForcedSingleThreaded() { return GForceSingleThreaded; }
+	void SetForceSingleThreaded(const bool bEnabled) { GForceSingleThreaded = bEnabled; }
+
 #pragma region FScope
 
 	FScope::FScope(const int32 InStart, const int32 InCount, const int32 InLoopIndex)
@@ -32,7 +45,7 @@ namespace PCGExMT
 
 	void ParallelOrSequential(const int32 Num, const FLoopBody& Body, const int32 Threshold, const EParallelForFlags Flags)
 	{
-		if (Num >= Threshold)
+		if (Num >= Threshold && !GForceSingleThreaded)
 		{
 			ParallelFor(Num, Body, Flags);
 		}
@@ -52,7 +65,7 @@ namespace PCGExMT
 			return;
 		}
 
-		if (Num >= Threshold)
+		if (Num >= Threshold && !GForceSingleThreaded)
 		{
 			// Divide into one chunk per worker thread -- amortizes Body's per-scope setup
 			// (e.g., FScopedTypedValue construction for type-erased buffer access).
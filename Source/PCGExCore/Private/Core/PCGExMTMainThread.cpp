@@ -0,0 +1,204 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExMTMainThread.h"
+
+#include "PCGExLog.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Core/PCGExMT.h"
+#include "HAL/IConsoleManager.h"
+
+namespace PCGExMT::MainThread
+{
+	static float GMainThreadBudgetMs = 5.0f;
+	static FAutoConsoleVariableRef CVarMainThreadBudgetMs(
+		TEXT("pcgex.MT.MainThreadBudgetMs"),
+		GMainThreadBudgetMs,
+		TEXT("Per-frame time budget (ms) for batched PCGEx game-thread callbacks. At least one callback runs per batch. <= 0 disables the budget."));
+
+	static FAutoConsoleCommand CommandMainThreadStats(
+		TEXT("pcgex.MT.MainThreadStats"),
+		TEXT("Logs PCGEx game-thread batching statistics."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				const FStats Stats = GetStats();
+				UE_LOG(LogPCGEx, Display, TEXT("Main thread: %lld queued, %lld executed in %d batches (max %d, %d deferred), latency avg %.3fms max %.3fms, busy %.3fms"),
+				       Stats.NumQueued, Stats.NumExecuted, Stats.NumBatches, Stats.MaxBatchSize, Stats.NumDeferredBatches,
+				       Stats.GetAverageLatency() * 1000, Stats.MaxLatencySeconds * 1000, Stats.BusySeconds * 1000);
+			}));
+
+	namespace
+	{
+		struct FEntry
+		{
+			FCallback Callback;
+			double QueuedAt = 0;
+		};
+
+		class FQueue
+		{
+			mutable FCriticalSection Lock;
+			TArray<FEntry> Pending[NumPriorities];
+			int32 NumPending = 0;
+			bool bDrainScheduled = false;
+			FStats Stats;
+
+		public:
+			static FQueue& Get()
+			{
+				static FQueue Instance;
+				return Instance;
+			}
+
+			void Enqueue(FCallback&& InCallback, const EPriority InPriority)
+			{
+				bool bSchedule = false;
+
+				{
+					FScopeLock ScopeLock(&Lock);
+					Pending[static_cast<uint8>(InPriority)].Add({MoveTemp(InCallback), FPlatformTime::Seconds()});
+					NumPending++;
+					Stats.NumQueued++;
+
+					if (!bDrainScheduled)
+					{
+						bDrainScheduled = true;
+						bSchedule = true;
+					}
+				}
+
+				// Only the first callback of a batch pays for a game-thread hop
+				if (bSchedule) { AsyncTask(ENamedThreads::GameThread, []() { Get().Drain(false); }); }
+			}
+
+			void Drain(const bool bIgnoreBudget)
+			{
+				check(IsInGameThread())
+
+				if (!bIgnoreBudget && IsObjectWorkBlocked())
+				{
+					DeferToNextFrame();
+					return;
+				}
+
+				const double BatchStart = FPlatformTime::Seconds();
+				const double Deadline = (bIgnoreBudget || GMainThreadBudgetMs <= 0) ? MAX_dbl : BatchStart + GMainThreadBudgetMs * 0.001;
+
+				int32 NumExecuted = 0;
+				double TotalLatency = 0;
+				double MaxLatency = 0;
+
+				while (true)
+				{
+					FEntry Entry;
+					if (!Pop(Entry)) { break; }
+
+					const double StartedAt = FPlatformTime::Seconds();
+					const double Latency = StartedAt - Entry.QueuedAt;
+					TotalLatency += Latency;
+					MaxLatency = FMath::Max(MaxLatency, Latency);
+
+					Entry.Callback();
+					NumExecuted++;
+
+					// A callback may itself trigger a save or GC; stop before the next one
+					if (FPlatformTime::Seconds() > Deadline || (!bIgnoreBudget && IsObjectWorkBlocked())) { break; }
+				}
+
+				bool bHasRemaining = false;
+
+				{
+					FScopeLock ScopeLock(&Lock);
+					Stats.NumExecuted += NumExecuted;
+					Stats.NumBatches++;
+					Stats.MaxBatchSize = FMath::Max(Stats.MaxBatchSize, NumExecuted);
+					Stats.TotalLatencySeconds += TotalLatency;
+					Stats.MaxLatencySeconds = FMath::Max(Stats.MaxLatencySeconds, MaxLatency);
+					Stats.BusySeconds += FPlatformTime::Seconds() - BatchStart;
+
+					bHasRemaining = NumPending > 0;
+					if (!bHasRemaining) { bDrainScheduled = false; }
+				}
+
+				if (bHasRemaining) { DeferToNextFrame(); }
+			}
+
+			int32 GetNumPending() const
+			{
+				FScopeLock ScopeLock(&Lock);
+				return NumPending;
+			}
+
+			FStats GetStats() const
+			{
+				FScopeLock ScopeLock(&Lock);
+				return Stats;
+			}
+
+			void ResetStats()
+			{
+				FScopeLock ScopeLock(&Lock);
+				Stats = FStats();
+			}
+
+		private:
+			bool Pop(FEntry& OutEntry)
+			{
+				FScopeLock ScopeLock(&Lock);
+				for (TArray<FEntry>& Queue : Pending)
+				{
+					if (Queue.IsEmpty()) { continue; }
+
+					// FIFO within a priority; batches are small enough that the shift is cheaper than a ring buffer
+					OutEntry = MoveTemp(Queue[0]);
+					Queue.RemoveAt(0, EAllowShrinking::No);
+					NumPending--;
+					return true;
+				}
+				return false;
+			}
+
+			void DeferToNextFrame()
+			{
+				{
+					FScopeLock ScopeLock(&Lock);
+					Stats.NumDeferredBatches++;
+				}
+
+				// Headless runners pump the task graph but nothing ticks the core ticker;
+				// there is no frame to spread over anyway, so keep draining through the task graph.
+				if (IsRunningCommandlet())
+				{
+					AsyncTask(ENamedThreads::GameThread, []() { Get().Drain(false); });
+					return;
+				}
+
+				FTSTicker::GetCoreTicker().AddTicker(
+					FTickerDelegate::CreateLambda(
+						[](float)
+						{
+							Get().Drain(false);
+							return false;
+						}));
+			}
+		};
+	}
+
+	void Enqueue(FCallback&& InCallback, const EPriority InPriority)
+	{
+		FQueue::Get().Enqueue(MoveTemp(InCallback), InPriority);
+	}
+
+	void Flush()
+	{
+		check(IsInGameThread())
+		while (FQueue::Get().GetNumPending() > 0) { FQueue::Get().Drain(true); }
+	}
+
+	int32 GetNumPending() { return FQueue::Get().GetNumPending(); }
+
+	FStats GetStats() { return FQueue::Get().GetStats(); }
+	void ResetStats() { FQueue::Get().ResetStats(); }
+}
@@ -0,0 +1,416 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExMTTelemetry.h"
+
+#include "PCGComponent.h"
+#include "PCGExLog.h"
+#include "Core/PCGExContext.h"
+#include "Core/PCGExSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace PCGExMT::Telemetry
+{
+	static int32 GTelemetryEnabled = 0;
+	static FAutoConsoleVariableRef CVarTelemetryEnabled(
+		TEXT("pcgex.Telemetry.Enabled"),
+		GTelemetryEnabled,
+		TEXT("If enabled, PCGEx task managers record per-group timings, queueing delay, idle time and main-thread hops."));
+
+	static int32 GTelemetryMaxExecutions = 8192;
+	static FAutoConsoleVariableRef CVarTelemetryMaxExecutions(
+		TEXT("pcgex.Telemetry.MaxExecutions"),
+		GTelemetryMaxExecutions,
+		TEXT("Maximum number of execution records kept in memory; oldest records are dropped first."));
+
+	static FAutoConsoleCommand CommandTelemetryExport(
+		TEXT("pcgex.Telemetry.Export"),
+		TEXT("Exports recorded PCGEx task telemetry as Chrome trace JSON and CSV. Optional argument: output directory."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				FRegistry::Get().ExportAll(Args.IsEmpty() ? FString() : Args[0]);
+			}));
+
+	static FAutoConsoleCommand CommandTelemetryReset(
+		TEXT("pcgex.Telemetry.Reset"),
+		TEXT("Discards all recorded PCGEx task telemetry."),
+		FConsoleCommandDelegate::CreateLambda([]() { FRegistry::Get().Reset(); }));
+
+	// -PCGExTelemetry only seeds the switch, once; the cvar and SetEnabled remain in control afterward.
+	static void SeedFromCommandLine()
+	{
+		static const bool bSeeded = []()
+		{
+			if (FParse::Param(FCommandLine::Get(), TEXT("PCGExTelemetry"))) { GTelemetryEnabled = 1; }
+			return true;
+		}();
+	}
+
+	bool IsEnabled()
+	{
+		SeedFromCommandLine();
+		return GTelemetryEnabled != 0;
+	}
+
+	void SetEnabled(const bool bEnabled)
+	{
+		SeedFromCommandLine();
+		GTelemetryEnabled = bEnabled ? 1 : 0;
+	}
+
+#pragma region FGroupRecord
+
+	FGroupRecord::FGroupRecord(const FName InName, const int32 InIndex, const int32 InParentIndex)
+	{
+		Stats.Name = InName;
+		Stats.Index = InIndex;
+		Stats.ParentIndex = InParentIndex;
+		Stats.CreatedAt = FPlatformTime::Seconds();
+		IdleSince = Stats.CreatedAt;
+	}
+
+	void FGroupRecord::OnTaskStart(const double LaunchedAt, const double StartedAt)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (Stats.FirstStartAt <= 0) { Stats.FirstStartAt = StartedAt; }
+
+		const double Delay = FMath::Max(0.0, StartedAt - LaunchedAt);
+		Stats.QueueDelaySeconds += Delay;
+		Stats.MaxQueueDelaySeconds = FMath::Max(Stats.MaxQueueDelaySeconds, Delay);
+		Stats.NumTasks++;
+
+		// Idle time is only accumulated while no task of this group is running
+		if (ActiveCount++ == 0) { Stats.IdleSeconds += FMath::Max(0.0, StartedAt - IdleSince); }
+	}
+
+	void FGroupRecord::OnTaskEnd(const double StartedAt, const double EndedAt)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		Stats.BusySeconds += FMath::Max(0.0, EndedAt - StartedAt);
+		if (--ActiveCount == 0) { IdleSince = EndedAt; }
+		ActiveCount = FMath::Max(0, ActiveCount);
+	}
+
+	void FGroupRecord::AddScopes(const int32 Count)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Stats.NumScopes += Count;
+	}
+
+	void FGroupRecord::OnMainThreadHop(const double QueuedAt, const double StartedAt, const double EndedAt)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Stats.MainThreadHops++;
+		Stats.MainThreadLatencySeconds += FMath::Max(0.0, StartedAt - QueuedAt);
+		Stats.MainThreadBusySeconds += FMath::Max(0.0, EndedAt - StartedAt);
+	}
+
+	void FGroupRecord::OnEnd(const bool bWasCancelled)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		// Managers can be reset & reused; keep the last end so the record spans every round.
+		Stats.EndAt = FPlatformTime::Seconds();
+		Stats.bCancelled |= bWasCancelled;
+		if (ActiveCount == 0)
+		{
+			Stats.IdleSeconds += FMath::Max(0.0, Stats.EndAt - IdleSince);
+			IdleSince = Stats.EndAt;
+		}
+	}
+
+	FGroupStats FGroupRecord::GetStats() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		FGroupStats Copy = Stats;
+		if (Copy.EndAt <= 0) { Copy.EndAt = FMath::Max(Copy.CreatedAt, FPlatformTime::Seconds()); }
+		return Copy;
+	}
+
+#pragma endregion
+
+#pragma region FExecutionRecord
+
+	FExecutionRecord::FExecutionRecord(const FPCGExContext* InContext)
+	{
+		static std::atomic<uint64> ExecutionCounter{0};
+		ExecutionId = ExecutionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+		StartedAt = FPlatformTime::Seconds();
+
+		if (!InContext) { return; }
+
+		if (const UPCGSettings* Settings = InContext->GetInputSettings<UPCGSettings>())
+		{
+			ElementName = Settings->GetClass()->GetName();
+			ElementName.RemoveFromStart(TEXT("PCGEx"));
+			ElementName.RemoveFromEnd(TEXT("Settings"));
+			NodeName = Settings->GetName();
+		}
+
+		SourceName = GetNameSafe(InContext->GetComponent());
+	}
+
+	TSharedPtr<FGroupRecord> FExecutionRecord::AddGroup(const FName InName, const int32 InParentIndex)
+	{
+		FScopeLock ScopeLock(&Lock);
+		TSharedPtr<FGroupRecord> NewRecord = MakeShared<FGroupRecord>(InName, Groups.Num(), InParentIndex);
+		Groups.Add(NewRecord);
+		return NewRecord;
+	}
+
+	void FExecutionRecord::GetGroupStats(TArray<FGroupStats>& OutStats) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		OutStats.Reset(Groups.Num());
+		for (const TSharedPtr<FGroupRecord>& Group : Groups) { OutStats.Add(Group->GetStats()); }
+	}
+
+#pragma endregion
+
+#pragma region FRegistry
+
+	FRegistry& FRegistry::Get()
+	{
+		static FRegistry Instance;
+		return Instance;
+	}
+
+	void FRegistry::Submit(const TSharedPtr<FExecutionRecord>& InRecord)
+	{
+		if (!InRecord) { return; }
+
+		InRecord->EndedAt = FPlatformTime::Seconds();
+
+		FScopeLock ScopeLock(&Lock);
+		Executions.Add(InRecord);
+
+		const int32 Overflow = Executions.Num() - FMath::Max(1, GTelemetryMaxExecutions);
+		if (Overflow > 0) { Executions.RemoveAt(0, Overflow, EAllowShrinking::No); }
+	}
+
+	void FRegistry::Reset()
+	{
+		FScopeLock ScopeLock(&Lock);
+		Executions.Empty();
+	}
+
+	int32 FRegistry::Num() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return Executions.Num();
+	}
+
+	void FRegistry::GetExecutions(TArray<TSharedPtr<FExecutionRecord>>& OutExecutions) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		OutExecutions = Executions;
+	}
+
+	void FRegistry::SwapExecutions(TArray<TSharedPtr<FExecutionRecord>>& InOutExecutions)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Swap(Executions, InOutExecutions);
+	}
+
+	namespace
+	{
+		FString Escape(const FString& In)
+		{
+			FString Out = In.ReplaceCharWithEscapedChar();
+			return Out.Replace(TEXT(","), TEXT(";"));
+		}
+
+		// ReplaceCharWithEscapedChar emits \' and friends, which aren't valid JSON escapes
+		FString EscapeJson(const FString& In)
+		{
+			FString Out;
+			Out.Reserve(In.Len());
+			for (const TCHAR Char : In)
+			{
+				switch (Char)
+				{
+				case TEXT('"'): Out += TEXT("\\\""); break;
+				case TEXT('\\'): Out += TEXT("\\\\"); break;
+				case TEXT('\n'): Out += TEXT("\\n"); break;
+				case TEXT('\r'): Out += TEXT("\\r"); break;
+				case TEXT('\t'): Out += TEXT("\\t"); break;
+				default:
+					if (Char < 0x20) { Out += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char)); }
+					else { Out.AppendChar(Char); }
+					break;
+				}
+			}
+			return Out;
+		}
+
+		double ToMicro(const double InSeconds) { return InSeconds * 1000000.0; }
+	}
+
+	bool FRegistry::ExportChromeTrace(const FString& InFilePath) const
+	{
+		TArray<TSharedPtr<FExecutionRecord>> LocalExecutions;
+		GetExecutions(LocalExecutions);
+
+		double Epoch = MAX_dbl;
+		for (const TSharedPtr<FExecutionRecord>& Execution : LocalExecutions) { Epoch = FMath::Min(Epoch, Execution->StartedAt); }
+		if (LocalExecutions.IsEmpty()) { Epoch = 0; }
+
+		TArray<FString> Events;
+		TArray<FGroupStats> Stats;
+
+		for (const TSharedPtr<FExecutionRecord>& Execution : LocalExecutions)
+		{
+			const uint64 Pid = Execution->ExecutionId;
+
+			Events.Add(FString::Printf(
+				TEXT("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%llu,\"args\":{\"name\":\"%s (%s) @ %s\"}}"),
+				Pid, *EscapeJson(Execution->ElementName), *EscapeJson(Execution->NodeName), *EscapeJson(Execution->SourceName)));
+
+			Execution->GetGroupStats(Stats);
+			for (const FGroupStats& Group : Stats)
+			{
+				Events.Add(FString::Printf(
+					TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%llu,\"tid\":%d,\"args\":{\"name\":\"%s\"}}"),
+					Pid, Group.Index, *EscapeJson(Group.Name.ToString())));
+
+				Events.Add(FString::Printf(
+					TEXT("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%llu,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{")
+					TEXT("\"parent\":%d,\"tasks\":%d,\"scopes\":%d,\"busy_us\":%.3f,\"queue_us\":%.3f,\"max_queue_us\":%.3f,")
+					TEXT("\"idle_us\":%.3f,\"main_thread_hops\":%d,\"main_thread_latency_us\":%.3f,\"main_thread_busy_us\":%.3f,\"cancelled\":%s}}"),
+					*EscapeJson(Group.Name.ToString()), *EscapeJson(Execution->ElementName), Pid, Group.Index,
+					ToMicro(Group.CreatedAt - Epoch), ToMicro(Group.GetWallSeconds()),
+					Group.ParentIndex, Group.NumTasks, Group.NumScopes, ToMicro(Group.BusySeconds), ToMicro(Group.QueueDelaySeconds), ToMicro(Group.MaxQueueDelaySeconds),
+					ToMicro(Group.IdleSeconds), Group.MainThreadHops, ToMicro(Group.MainThreadLatencySeconds), ToMicro(Group.MainThreadBusySeconds),
+					Group.bCancelled ? TEXT("true") : TEXT("false")));
+			}
+		}
+
+		const FString Output = FString::Printf(TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n%s\n]}"), *FString::Join(Events, TEXT(",\n")));
+		return FFileHelper::SaveStringToFile(Output, *InFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	bool FRegistry::ExportGroupsCSV(const FString& InFilePath) const
+	{
+		TArray<TSharedPtr<FExecutionRecord>> LocalExecutions;
+		GetExecutions(LocalExecutions);
+
+		TArray<FString> Lines;
+		Lines.Add(TEXT("ExecutionId,Element,Node,Source,Group,GroupIndex,ParentIndex,WallMs,BusyMs,IdleMs,QueueMs,MaxQueueMs,Tasks,Scopes,MainThreadHops,MainThreadLatencyMs,MainThreadBusyMs,Cancelled"));
+
+		TArray<FGroupStats> Stats;
+		for (const TSharedPtr<FExecutionRecord>& Execution : LocalExecutions)
+		{
+			Execution->GetGroupStats(Stats);
+			for (const FGroupStats& Group : Stats)
+			{
+				Lines.Add(FString::Printf(
+					TEXT("%llu,%s,%s,%s,%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%d,%d,%d,%.4f,%.4f,%d"),
+					Execution->ExecutionId, *Escape(Execution->ElementName), *Escape(Execution->NodeName), *Escape(Execution->SourceName),
+					*Escape(Group.Name.ToString()), Group.Index, Group.ParentIndex,
+					Group.GetWallSeconds() * 1000, Group.BusySeconds * 1000, Group.IdleSeconds * 1000, Group.QueueDelaySeconds * 1000, Group.MaxQueueDelaySeconds * 1000,
+					Group.NumTasks, Group.NumScopes, Group.MainThreadHops, Group.MainThreadLatencySeconds * 1000, Group.MainThreadBusySeconds * 1000,
+					Group.bCancelled ? 1 : 0));
+			}
+		}
+
+		return FFileHelper::SaveStringToFile(FString::Join(Lines, TEXT("\n")), *InFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	bool FRegistry::ExportElementsCSV(const FString& InFilePath) const
+	{
+		TArray<TSharedPtr<FExecutionRecord>> LocalExecutions;
+		GetExecutions(LocalExecutions);
+
+		struct FElementAggregate
+		{
+			int32 NumExecutions = 0;
+			int32 NumGroups = 0;
+			int32 NumTasks = 0;
+			int32 NumScopes = 0;
+			int32 MainThreadHops = 0;
+			double WallSeconds = 0;
+			double MaxWallSeconds = 0;
+			double BusySeconds = 0;
+			double IdleSeconds = 0;
+			double QueueDelaySeconds = 0;
+			double MainThreadLatencySeconds = 0;
+		};
+
+		TMap<FString, FElementAggregate> Aggregates;
+		TArray<FGroupStats> Stats;
+
+		for (const TSharedPtr<FExecutionRecord>& Execution : LocalExecutions)
+		{
+			FElementAggregate& Aggregate = Aggregates.FindOrAdd(Execution->ElementName);
+			const double Wall = FMath::Max(0.0, Execution->EndedAt - Execution->StartedAt);
+
+			Aggregate.NumExecutions++;
+			Aggregate.WallSeconds += Wall;
+			Aggregate.MaxWallSeconds = FMath::Max(Aggregate.MaxWallSeconds, Wall);
+
+			Execution->GetGroupStats(Stats);
+			for (const FGroupStats& Group : Stats)
+			{
+				Aggregate.NumGroups++;
+				Aggregate.NumTasks += Group.NumTasks;
+				Aggregate.NumScopes += Group.NumScopes;
+				Aggregate.MainThreadHops += Group.MainThreadHops;
+				Aggregate.BusySeconds += Group.BusySeconds;
+				Aggregate.IdleSeconds += Group.IdleSeconds;
+				Aggregate.QueueDelaySeconds += Group.QueueDelaySeconds;
+				Aggregate.MainThreadLatencySeconds += Group.MainThreadLatencySeconds;
+			}
+		}
+
+		Aggregates.KeySort([](const FString& A, const FString& B) { return A < B; });
+
+		TArray<FString> Lines;
+		Lines.Add(TEXT("Element,Executions,Groups,Tasks,Scopes,TotalWallMs,MaxWallMs,BusyMs,IdleMs,QueueMs,MainThreadHops,MainThreadLatencyMs"));
+
+		for (const TPair<FString, FElementAggregate>& Pair : Aggregates)
+		{
+			const FElementAggregate& A = Pair.Value;
+			Lines.Add(FString::Printf(
+				TEXT("%s,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%d,%.4f"),
+				*Escape(Pair.Key), A.NumExecutions, A.NumGroups, A.NumTasks, A.NumScopes,
+				A.WallSeconds * 1000, A.MaxWallSeconds * 1000, A.BusySeconds * 1000, A.IdleSeconds * 1000, A.QueueDelaySeconds * 1000,
+				A.MainThreadHops, A.MainThreadLatencySeconds * 1000));
+		}
+
+		return FFileHelper::SaveStringToFile(FString::Join(Lines, TEXT("\n")), *InFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	bool FRegistry::ExportAll(const FString& InDirectory) const
+	{
+		const FString Directory = InDirectory.IsEmpty() ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("Telemetry")) : InDirectory;
+
+		const bool bSuccess =
+			ExportChromeTrace(FPaths::Combine(Directory, TEXT("PCGExTelemetry_Trace.json")))
+			&& ExportGroupsCSV(FPaths::Combine(Directory, TEXT("PCGExTelemetry_Groups.csv")))
+			&& ExportElementsCSV(FPaths::Combine(Directory, TEXT("PCGExTelemetry_Elements.csv")));
+
+		if (bSuccess) { UE_LOG(LogPCGEx, Log, TEXT("PCGEx telemetry: exported %d execution records to %s"), Num(), *Directory); }
+		else { UE_LOG(LogPCGEx, Error, TEXT("PCGEx telemetry: failed to export to %s"), *Directory); }
+
+		return bSuccess;
+	}
+
+#pragma endregion
+
+	void FlushOnShutdown()
+	{
+		FString Directory;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("PCGExTelemetryDir="), Directory)) { return; }
+		if (FRegistry::Get().Num() == 0) { return; }
+		FRegistry::Get().ExportAll(Directory);
+	}
+}
@@ -0,0 +1,480 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/Utils/PCGExDataFingerprint.h"
+
+#include "PCGData.h"
+#include "PCGExH.h"
+#include "Clusters/PCGExClusterCommon.h"
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExDataTags.h"
+#include "Data/PCGExPointIO.h"
+#include "Helpers/PCGExMetaHelpers.h"
+#include "Metadata/PCGMetadata.h"
+#include "Metadata/PCGMetadataAttribute.h"
+
+namespace PCGExFingerprint
+{
+	namespace
+	{
+		constexpr uint64 Seed = 0x9E3779B97F4A7C15ull;
+		constexpr int64 NaNSentinel = MIN_int64;
+
+		FORCEINLINE uint64 Mix(const uint64 H, const uint64 V)
+		{
+			// splitmix64 finalizer over a boost-style combine; cheap and well distributed
+			uint64 X = H ^ (V + Seed + (H << 6) + (H >> 2));
+			X = (X ^ (X >> 30)) * 0xBF58476D1CE4E5B9ull;
+			X = (X ^ (X >> 27)) * 0x94D049BB133111EBull;
+			return X ^ (X >> 31);
+		}
+
+		FORCEINLINE uint64 HashString(const FString& In)
+		{
+			// GetTypeHash(FString) is case-insensitive, which is not what equivalence means
+			return CityHash64(reinterpret_cast<const char*>(*In), In.Len() * sizeof(TCHAR));
+		}
+
+		FORCEINLINE uint64 HashChannelName(const FString& In) { return Mix(Seed, HashString(In)); }
+
+		/** Per-type quantized value hashing. */
+		struct FQuantizer
+		{
+			double InvTolerance = 1000;
+
+			explicit FQuantizer(const double InTolerance)
+				: InvTolerance(1.0 / FMath::Max(InTolerance, UE_DOUBLE_SMALL_NUMBER))
+			{
+			}
+
+			FORCEINLINE uint64 Q(const double V) const
+			{
+				if (FMath::IsNaN(V)) { return static_cast<uint64>(NaNSentinel); }
+				// llround folds -0 into 0; clamping keeps infinities stable
+				return static_cast<uint64>(llround(FMath::Clamp(V * InvTolerance, -9.0e18, 9.0e18)));
+			}
+
+			FORCEINLINE uint64 Hash(const float V) const { return Q(V); }
+			FORCEINLINE uint64 Hash(const double V) const { return Q(V); }
+			FORCEINLINE uint64 Hash(const int32 V) const { return static_cast<uint64>(V); }
+			FORCEINLINE uint64 Hash(const int64 V) const { return static_cast<uint64>(V); }
+			FORCEINLINE uint64 Hash(const bool V) const { return V ? 1 : 0; }
+			FORCEINLINE uint64 Hash(const FVector2D& V) const { return Mix(Q(V.X), Q(V.Y)); }
+			FORCEINLINE uint64 Hash(const FVector& V) const { return Mix(Mix(Q(V.X), Q(V.Y)), Q(V.Z)); }
+			FORCEINLINE uint64 Hash(const FVector4& V) const { return Mix(Mix(Mix(Q(V.X), Q(V.Y)), Q(V.Z)), Q(V.W)); }
+
+			FORCEINLINE uint64 Hash(const FQuat& V) const
+			{
+				// q and -q are the same rotation
+				const FQuat C = V.W < 0 ? -V : V;
+				return Mix(Mix(Mix(Q(C.X), Q(C.Y)), Q(C.Z)), Q(C.W));
+			}
+
+			FORCEINLINE uint64 Hash(const FRotator& V) const { return Hash(V.Quaternion()); }
+			FORCEINLINE uint64 Hash(const FTransform& V) const { return Mix(Mix(Hash(V.GetLocation()), Hash(V.GetRotation())), Hash(V.GetScale3D())); }
+			FORCEINLINE uint64 Hash(const FString& V) const { return HashString(V); }
+			FORCEINLINE uint64 Hash(const FName& V) const { return HashString(V.ToString()); }
+			FORCEINLINE uint64 Hash(const FSoftObjectPath& V) const { return HashString(V.ToString()); }
+			FORCEINLINE uint64 Hash(const FSoftClassPath& V) const { return HashString(V.ToString()); }
+		};
+
+		/** Accumulates one channel at a time into per-point hashes, and keeps the per-channel digest for diffs. */
+		class FAccumulator
+		{
+			const FOptions& Options;
+			TArray<uint64> ChannelValues;
+
+		public:
+			FFingerprint& Out;
+			TArray<uint64> PointHashes;
+
+			FAccumulator(const FOptions& InOptions, FFingerprint& InOut, const int32 NumPoints)
+				: Options(InOptions), Out(InOut)
+			{
+				PointHashes.Init(Seed, NumPoints);
+				ChannelValues.SetNumUninitialized(NumPoints);
+			}
+
+			template <typename FGetter>
+			void AddChannel(const FString& InName, FGetter&& Getter)
+			{
+				const uint64 NameHash = HashChannelName(InName);
+				const int32 NumPoints = PointHashes.Num();
+
+				for (int i = 0; i < NumPoints; i++)
+				{
+					const uint64 Value = Getter(i);
+					ChannelValues[i] = Value;
+					PointHashes[i] = Mix(PointHashes[i], Mix(NameHash, Value));
+				}
+
+				if (Options.bOrderIndependent) { ChannelValues.Sort(); }
+
+				uint64 ChannelHash = NameHash;
+				for (const uint64 Value : ChannelValues) { ChannelHash = Mix(ChannelHash, Value); }
+				Out.Channels.Emplace(InName, ChannelHash);
+			}
+
+			void AddSingle(const FString& InName, const uint64 InValue)
+			{
+				Out.Channels.Emplace(InName, Mix(HashChannelName(InName), InValue));
+			}
+
+			void Finalize()
+			{
+				if (Options.bOrderIndependent) { PointHashes.Sort(); }
+
+				uint64 Hash = Mix(Seed, PointHashes.Num());
+				for (const uint64 PointHash : PointHashes) { Hash = Mix(Hash, PointHash); }
+
+				// Channel-level entries (tags, data-domain attributes...) don't live on points
+				for (const TPair<FString, uint64>& Channel : Out.Channels)
+				{
+					if (Channel.Key.StartsWith(TEXT("#")) || Channel.Key.StartsWith(TEXT("@Data."))) { Hash = Mix(Hash, Channel.Value); }
+				}
+
+				Out.Hash = Hash;
+			}
+		};
+
+		void HashAttributes(const UPCGBasePointData* InData, const FOptions& InOptions, const FQuantizer& Quantizer, FAccumulator& Accumulator)
+		{
+			const UPCGMetadata* Metadata = InData->ConstMetadata();
+			if (!Metadata) { return; }
+
+			TArray<FPCGAttributeIdentifier> Identifiers;
+			TArray<EPCGMetadataTypes> Types;
+			Metadata->GetAllAttributes(Identifiers, Types);
+
+			// Attribute creation order is an implementation detail
+			TArray<int32> Order;
+			Order.SetNumUninitialized(Identifiers.Num());
+			for (int i = 0; i < Order.Num(); i++) { Order[i] = i; }
+			Order.Sort([&](const int32 A, const int32 B) { return Identifiers[A].ToString() < Identifiers[B].ToString(); });
+
+			const TConstPCGValueRange<int64> Entries = InData->GetConstMetadataEntryValueRange();
+
+			for (const int32 Index : Order)
+			{
+				const FPCGAttributeIdentifier& Identifier = Identifiers[Index];
+				if (InOptions.IgnoredAttributes.Contains(Identifier.Name)) { continue; }
+
+				const FPCGMetadataAttributeBase* Attribute = Metadata->GetConstAttribute(Identifier);
+				if (!Attribute) { continue; }
+
+				const bool bDataDomain = Identifier.MetadataDomain == PCGMetadataDomainID::Data;
+				const FString ChannelName = (bDataDomain ? TEXT("@Data.") : TEXT("@")) + Identifier.Name.ToString() + FString::Printf(TEXT(":%d"), static_cast<int32>(Types[Index]));
+
+				PCGExMetaHelpers::ExecuteWithRightType(
+					Attribute->GetTypeId(), [&](auto DummyValue)
+					{
+						using T = decltype(DummyValue);
+						const FPCGMetadataAttribute<T>* TypedAttribute = static_cast<const FPCGMetadataAttribute<T>*>(Attribute);
+
+						if (bDataDomain)
+						{
+							Accumulator.AddSingle(ChannelName, Quantizer.Hash(TypedAttribute->GetValueFromItemKey(PCGFirstEntryKey)));
+							return;
+						}
+
+						Accumulator.AddChannel(ChannelName, [&](const int32 i) { return Quantizer.Hash(TypedAttribute->GetValueFromItemKey(Entries[i])); });
+					});
+			}
+		}
+
+		void HashTags(const TSet<FString>* InTags, FAccumulator& Accumulator)
+		{
+			TArray<FString> Sorted = InTags ? InTags->Array() : TArray<FString>();
+
+			// Cluster pairing ids are unique object ids; only their presence matters
+			for (FString& Tag : Sorted)
+			{
+				if (Tag.StartsWith(PCGExClusters::Labels::TagStr_PCGExCluster)) { Tag = PCGExClusters::Labels::TagStr_PCGExCluster; }
+			}
+
+			Sorted.Sort();
+
+			uint64 Hash = Seed;
+			for (const FString& Tag : Sorted) { Hash = Mix(Hash, HashString(Tag)); }
+			Accumulator.AddSingle(TEXT("#Tags"), Hash);
+		}
+
+		bool GetClusterPairId(const FPCGTaggedData& InTaggedData, FString& OutId)
+		{
+			for (const FString& Tag : InTaggedData.Tags)
+			{
+				if (!Tag.StartsWith(PCGExClusters::Labels::TagStr_PCGExCluster)) { continue; }
+				OutId = Tag;
+				return true;
+			}
+			return false;
+		}
+	}
+
+	FOptions::FOptions()
+	{
+		IgnoredAttributes.Add(PCGExClusters::Labels::Attr_PCGExEdgeIdx);
+		IgnoredAttributes.Add(PCGExClusters::Labels::Attr_PCGExVtxIdx);
+	}
+
+	FString FFingerprint::ToString() const
+	{
+		return FString::Printf(TEXT("%s [%016llx] %d points"), *Label, Hash, NumPoints);
+	}
+
+	FFingerprint Compute(const UPCGBasePointData* InData, const TSet<FString>* InTags, const FOptions& InOptions)
+	{
+		FFingerprint Fingerprint;
+		if (!InData) { return Fingerprint; }
+
+		const int32 NumPoints = InData->GetNumPoints();
+		Fingerprint.NumPoints = NumPoints;
+
+		const FQuantizer Quantizer(InOptions.Tolerance);
+		FAccumulator Accumulator(InOptions, Fingerprint, NumPoints);
+
+		if (InOptions.bIncludeProperties)
+		{
+			const TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+			const TConstPCGValueRange<float> Density = InData->GetConstDensityValueRange();
+			const TConstPCGValueRange<FVector> BoundsMin = InData->GetConstBoundsMinValueRange();
+			const TConstPCGValueRange<FVector> BoundsMax = InData->GetConstBoundsMaxValueRange();
+			const TConstPCGValueRange<FVector4> Color = InData->GetConstColorValueRange();
+			const TConstPCGValueRange<float> Steepness = InData->GetConstSteepnessValueRange();
+
+			Accumulator.AddChannel(TEXT("$Position"), [&](const int32 i) { return Quantizer.Hash(Transforms[i].GetLocation()); });
+			Accumulator.AddChannel(TEXT("$Rotation"), [&](const int32 i) { return Quantizer.Hash(Transforms[i].GetRotation()); });
+			Accumulator.AddChannel(TEXT("$Scale"), [&](const int32 i) { return Quantizer.Hash(Transforms[i].GetScale3D()); });
+			Accumulator.AddChannel(TEXT("$Density"), [&](const int32 i) { return Quantizer.Hash(Density[i]); });
+			Accumulator.AddChannel(TEXT("$BoundsMin"), [&](const int32 i) { return Quantizer.Hash(BoundsMin[i]); });
+			Accumulator.AddChannel(TEXT("$BoundsMax"), [&](const int32 i) { return Quantizer.Hash(BoundsMax[i]); });
+			Accumulator.AddChannel(TEXT("$Color"), [&](const int32 i) { return Quantizer.Hash(Color[i]); });
+			Accumulator.AddChannel(TEXT("$Steepness"), [&](const int32 i) { return Quantizer.Hash(Steepness[i]); });
+
+			if (InOptions.bIncludeSeed)
+			{
+				const TConstPCGValueRange<int32> Seeds = InData->GetConstSeedValueRange();
+				Accumulator.AddChannel(TEXT("$Seed"), [&](const int32 i) { return Quantizer.Hash(Seeds[i]); });
+			}
+		}
+
+		if (InOptions.bIncludeAttributes) { HashAttributes(InData, InOptions, Quantizer, Accumulator); }
+		if (InOptions.bIncludeTags) { HashTags(InTags, Accumulator); }
+
+		Accumulator.Finalize();
+		return Fingerprint;
+	}
+
+	FFingerprint Compute(const PCGExData::FPointIO& InPointIO, const FOptions& InOptions)
+	{
+		const TSet<FString> Tags = InPointIO.Tags ? InPointIO.Tags->Flatten() : TSet<FString>();
+		FFingerprint Fingerprint = Compute(InPointIO.GetOutIn(), &Tags, InOptions);
+		Fingerprint.Label = FString::Printf(TEXT("%s[%d]"), *InPointIO.OutputPin.ToString(), InPointIO.IOIndex);
+		return Fingerprint;
+	}
+
+	FFingerprint Compute(const PCGExData::FFacade& InFacade, const FOptions& InOptions)
+	{
+		return Compute(*InFacade.Source, InOptions);
+	}
+
+	FFingerprint ComputeTopology(const UPCGBasePointData* InVtx, const UPCGBasePointData* InEdges, const FOptions& InOptions)
+	{
+		FFingerprint Fingerprint;
+		Fingerprint.Label = TEXT("Topology");
+		if (!InVtx || !InEdges) { return Fingerprint; }
+
+		const FPCGMetadataAttribute<int64>* VtxEndpoints = InVtx->ConstMetadata() ? InVtx->ConstMetadata()->GetConstTypedAttribute<int64>(PCGExClusters::Labels::Attr_PCGExVtxIdx) : nullptr;
+		const FPCGMetadataAttribute<int64>* EdgeEndpoints = InEdges->ConstMetadata() ? InEdges->ConstMetadata()->GetConstTypedAttribute<int64>(PCGExClusters::Labels::Attr_PCGExEdgeIdx) : nullptr;
+		if (!VtxEndpoints || !EdgeEndpoints) { return Fingerprint; }
+
+		const FQuantizer Quantizer(InOptions.Tolerance);
+
+		// Vtx id (first half of the vtx endpoint hash) -> quantized position hash, same resolution as FCluster::BuildFrom
+		const TConstPCGValueRange<FTransform> VtxTransforms = InVtx->GetConstTransformValueRange();
+		const TConstPCGValueRange<int64> VtxEntries = InVtx->GetConstMetadataEntryValueRange();
+
+		TMap<uint32, uint64> VtxHashes;
+		VtxHashes.Reserve(InVtx->GetNumPoints());
+		for (int i = 0; i < InVtx->GetNumPoints(); i++)
+		{
+			VtxHashes.Add(PCGEx::H64A(VtxEndpoints->GetValueFromItemKey(VtxEntries[i])), Quantizer.Hash(VtxTransforms[i].GetLocation()));
+		}
+
+		const TConstPCGValueRange<int64> EdgeEntries = InEdges->GetConstMetadataEntryValueRange();
+		const int32 NumEdges = InEdges->GetNumPoints();
+
+		TArray<uint64> EdgeHashes;
+		EdgeHashes.SetNumUninitialized(NumEdges);
+
+		int32 NumUnresolved = 0;
+		for (int i = 0; i < NumEdges; i++)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(EdgeEndpoints->GetValueFromItemKey(EdgeEntries[i]), A, B);
+
+			const uint64* HA = VtxHashes.Find(A);
+			const uint64* HB = VtxHashes.Find(B);
+			if (!HA || !HB)
+			{
+				NumUnresolved++;
+				EdgeHashes[i] = 0;
+				continue;
+			}
+
+			EdgeHashes[i] = *HA < *HB ? Mix(*HA, *HB) : Mix(*HB, *HA);
+		}
+
+		if (InOptions.bOrderIndependent) { EdgeHashes.Sort(); }
+
+		uint64 Hash = Mix(Seed, NumEdges);
+		for (const uint64 EdgeHash : EdgeHashes) { Hash = Mix(Hash, EdgeHash); }
+
+		Fingerprint.Hash = Hash;
+		Fingerprint.NumPoints = NumEdges;
+		Fingerprint.Channels.Emplace(TEXT("~Edges"), Hash);
+		Fingerprint.Channels.Emplace(TEXT("~Unresolved"), NumUnresolved);
+
+		return Fingerprint;
+	}
+
+	FFingerprint Compute(const FPCGDataCollection& InCollection, const FOptions& InOptions)
+	{
+		FFingerprint Fingerprint;
+		Fingerprint.Label = TEXT("Collection");
+
+		// Cluster pair id -> vtx data, so edges can resolve their endpoints
+		TMap<FString, const UPCGBasePointData*> VtxByPairId;
+		for (const FPCGTaggedData& TaggedData : InCollection.TaggedData)
+		{
+			const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(TaggedData.Data);
+			FString PairId;
+			if (!PointData || !GetClusterPairId(TaggedData, PairId)) { continue; }
+			if (PointData->ConstMetadata() && PointData->ConstMetadata()->HasAttribute(PCGExClusters::Labels::Attr_PCGExVtxIdx)) { VtxByPairId.Add(PairId, PointData); }
+		}
+
+		TMap<FName, int32> PinCounters;
+		TMap<FName, TArray<uint64>> PinHashes;
+
+		for (const FPCGTaggedData& TaggedData : InCollection.TaggedData)
+		{
+			const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(TaggedData.Data);
+			if (!PointData) { continue; }
+
+			const int32 IndexInPin = PinCounters.FindOrAdd(TaggedData.Pin)++;
+
+			FFingerprint& Child = Fingerprint.Children.Add_GetRef(Compute(PointData, &TaggedData.Tags, InOptions));
+			Child.Label = FString::Printf(TEXT("%s[%d]"), *TaggedData.Pin.ToString(), IndexInPin);
+
+			FString PairId;
+			if (GetClusterPairId(TaggedData, PairId) && PointData->ConstMetadata() && PointData->ConstMetadata()->HasAttribute(PCGExClusters::Labels::Attr_PCGExEdgeIdx))
+			{
+				if (const UPCGBasePointData* const* Vtx = VtxByPairId.Find(PairId))
+				{
+					const FFingerprint Topology = ComputeTopology(*Vtx, PointData, InOptions);
+					Child.Channels.Append(Topology.Channels);
+					Child.Hash = Mix(Child.Hash, Topology.Hash);
+				}
+			}
+
+			PinHashes.FindOrAdd(TaggedData.Pin).Add(Child.Hash);
+			Fingerprint.NumPoints += Child.NumPoints;
+		}
+
+		PinHashes.KeySort([](const FName& A, const FName& B) { return A.LexicalLess(B); });
+
+		uint64 Hash = Seed;
+		for (TPair<FName, TArray<uint64>>& Pin : PinHashes)
+		{
+			if (InOptions.bOrderIndependent) { Pin.Value.Sort(); }
+
+			Hash = Mix(Hash, HashString(Pin.Key.ToString()));
+			for (const uint64 DataHash : Pin.Value) { Hash = Mix(Hash, DataHash); }
+		}
+
+		Fingerprint.Hash = Hash;
+
+		if (InOptions.bOrderIndependent)
+		{
+			// Keep children comparable one-to-one in Diff: grouped by pin, then by content.
+			// Labels end with the index in the pin, which is precisely what must not matter here.
+			auto GetPin = [](const FString& InLabel)
+			{
+				int32 Bracket = INDEX_NONE;
+				return InLabel.FindLastChar(TEXT('['), Bracket) ? InLabel.Left(Bracket) : InLabel;
+			};
+
+			Fingerprint.Children.Sort(
+				[&](const FFingerprint& A, const FFingerprint& B)
+				{
+					const int32 PinCompare = GetPin(A.Label).Compare(GetPin(B.Label), ESearchCase::CaseSensitive);
+					if (PinCompare != 0) { return PinCompare < 0; }
+					return A.Hash < B.Hash;
+				});
+		}
+
+		return Fingerprint;
+	}
+
+	uint64 ComputeSettings(const UObject* InObject, const UClass* InBaseClass)
+	{
+		if (!InObject) { return 0; }
+
+		const UClass* Class = InObject->GetClass();
+		uint64 Hash = HashChannelName(Class->GetPathName());
+
+		FString Value;
+		for (TFieldIterator<FProperty> It(Class); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (InBaseClass && !Property->GetOwnerClass()->IsChildOf(InBaseClass)) { continue; }
+			if (Property->HasAnyPropertyFlags(CPF_Transient)) { continue; }
+
+			for (int32 i = 0; i < Property->ArrayDim; i++)
+			{
+				Value.Reset();
+				Property->ExportText_InContainer(i, Value, InObject, nullptr, nullptr, PPF_None);
+				Hash = Mix(Mix(Hash, HashString(Property->GetName())), HashString(Value));
+			}
+		}
+
+		return Hash;
+	}
+
+	bool Diff(const FFingerprint& A, const FFingerprint& B, TArray<FString>& OutDifferences)
+	{
+		if (A.Hash == B.Hash) { return true; }
+
+		const int32 NumBefore = OutDifferences.Num();
+
+		if (A.NumPoints != B.NumPoints) { OutDifferences.Add(FString::Printf(TEXT("%s : %d points vs %d"), *A.Label, A.NumPoints, B.NumPoints)); }
+
+		if (!A.Children.IsEmpty() || !B.Children.IsEmpty())
+		{
+			if (A.Children.Num() != B.Children.Num()) { OutDifferences.Add(FString::Printf(TEXT("%s : %d data vs %d"), *A.Label, A.Children.Num(), B.Children.Num())); }
+			for (int i = 0; i < FMath::Min(A.Children.Num(), B.Children.Num()); i++) { Diff(A.Children[i], B.Children[i], OutDifferences); }
+		}
+		else
+		{
+			TMap<FString, uint64> ChannelsB;
+			for (const TPair<FString, uint64>& Channel : B.Channels) { ChannelsB.Add(Channel.Key, Channel.Value); }
+
+			for (const TPair<FString, uint64>& Channel : A.Channels)
+			{
+				const uint64* Other = ChannelsB.Find(Channel.Key);
+				if (!Other) { OutDifferences.Add(FString::Printf(TEXT("%s : %s missing"), *A.Label, *Channel.Key)); }
+				else if (*Other != Channel.Value) { OutDifferences.Add(FString::Printf(TEXT("%s : %s differs"), *A.Label, *Channel.Key)); }
+				ChannelsB.Remove(Channel.Key);
+			}
+
+			for (const TPair<FString, uint64>& Extra : ChannelsB) { OutDifferences.Add(FString::Printf(TEXT("%s : unexpected %s"), *A.Label, *Extra.Key)); }
+		}
+
+		// Same channels but different per-point association (e.g values swapped between points)
+		if (OutDifferences.Num() == NumBefore) { OutDifferences.Add(FString::Printf(TEXT("%s : per-point values differ"), *A.Label)); }
+
+		return false;
+	}
+}
@@ -101,7 +101,7 @@ namespace PCGExHelpers
 				}
 				PCGEX_ASYNC_RELEASE_TOKEN(LoadToken)
 			}
-		});
+		}, PCGExMT::MainThread::EPriority::High);
 	}
 
 	void SafeReleaseHandle(TSharedPtr<FStreamableHandle>& InHandle)
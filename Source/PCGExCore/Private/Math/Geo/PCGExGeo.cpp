@@ -342,14 +342,21 @@ namespace PCGExMath::Geo
 			}
 		}
 
-		const float DZ = FMath::Max(ZMin - LocalPoint.Z, LocalPoint.Z - ZMax);
-		if (Winding == 0 && DZ > 0.0f)
+		return CombinePolygonPrismDistance(Winding != 0, MinDistSq, LocalPoint.Z, ZMin, ZMax);
+	}
+
+	float CombinePolygonPrismDistance(
+		const bool bInside2D, const float MinDistSq2D,
+		const float LocalZ, const float ZMin, const float ZMax)
+	{
+		const float DZ = FMath::Max(ZMin - LocalZ, LocalZ - ZMax);
+		if (!bInside2D && DZ > 0.0f)
 		{
-			return FMath::Sqrt(MinDistSq + DZ * DZ);
+			return FMath::Sqrt(MinDistSq2D + DZ * DZ);
 		}
 
-		const float EdgeDist = FMath::Sqrt(MinDistSq);
-		const float D2D = (Winding != 0) ? -EdgeDist : EdgeDist;
+		const float EdgeDist = FMath::Sqrt(MinDistSq2D);
+		const float D2D = bInside2D ? -EdgeDist : EdgeDist;
 		if (D2D > 0.0f)
 		{
 			return D2D;
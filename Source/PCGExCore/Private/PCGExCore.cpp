@@ -3,6 +3,8 @@
 
 #include "PCGExCore.h"
 
+#include "Core/PCGExMTMainThread.h"
+#include "Core/PCGExMTTelemetry.h"
 #include "Data/PCGExSubAccessor.h"
 
 #if WITH_EDITOR
@@ -21,6 +23,15 @@ void FPCGExCoreModule::StartupModule()
 	PCGExData::FSubAccessorRegistry::Initialize();
 }
 
+void FPCGExCoreModule::ShutdownModule()
+{
+	// Run whatever is still queued for the game thread rather than silently dropping it;
+	// first so that its telemetry makes it into the shutdown export.
+	if (IsInGameThread()) { PCGExMT::MainThread::Flush(); }
+	PCGExMT::Telemetry::FlushOnShutdown();
+	IPCGExLegacyModuleInterface::ShutdownModule();
+}
+
 #if WITH_EDITOR
 void FPCGExCoreModule::RegisterToEditor(const TSharedPtr<FSlateStyleSet>& InStyle)
 {
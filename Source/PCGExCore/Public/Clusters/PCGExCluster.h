@@ -42,6 +42,7 @@ namespace PCGExClusters
 {
 	struct FBoundedEdge;
 	class ICachedClusterData;
+	class FEdgeBVH;
 }
 
 namespace PCGExClusters
@@ -58,6 +59,10 @@ namespace PCGExClusters
 		TSharedPtr<FCluster> OriginalCluster = nullptr;
 
 		mutable FRWLock ClusterLock;
+		mutable FCriticalSection EdgeBVHLock;
+		FCriticalSection OctreeLock;
+		int8 bNodeOctreeReady = 0; // Set once NodeOctree is fully built; lets GetNodeOctree skip the lock
+		int8 bEdgeOctreeReady = 0;
 
 		TMap<FName, TSharedPtr<ICachedClusterData>> CachedData;
 
@@ -403,6 +408,8 @@ namespace PCGExClusters
 		FVector GetEdgeDir(const int32 InEdgeIndex, const int32 InStartPtIndex) const;
 		FVector GetEdgeDir(const FLink Lk, const int32 InStartPtIndex) const;
 
+		/** Built on first use if RebuildOctree wasn't called beforehand. Thread-safe; only the first build takes a lock.
+		 * Forced rebuilds must not run concurrently with queries. */
 		TSharedPtr<PCGExOctree::FItemOctree> GetNodeOctree();
 		TSharedPtr<PCGExOctree::FItemOctree> GetEdgeOctree();
 
@@ -416,6 +423,15 @@ namespace PCGExClusters
 		int32 FindClosestNode(const FVector& Position, const int32 MinNeighbors = 0) const;
 		int32 FindClosestNodeFromEdge(const FVector& Position, const int32 MinNeighbors = 0) const;
 
+		/** Exact closest edge (point-segment distance) to Position, -1 if none qualifies. Uses the cached edge BVH. */
+		int32 FindClosestEdge(const FVector& Position, const int32 MinNeighbors = 0) const;
+
+		/** Batched FindClosestNodeFromEdge, parallel over positions. */
+		void FindClosestNodesFromEdge(TConstArrayView<FVector> Positions, TArray<int32>& OutNodes, const int32 MinNeighbors = 0) const;
+
+		/** Edge segment BVH, built on first use and cached (see FEdgeBVH). Thread-safe. */
+		TSharedPtr<FEdgeBVH> GetEdgeBVH() const;
+
 		int32 FindClosestEdge(const int32 InNodeIndex, const FVector& InPosition, const int32 MinNeighbors = 0) const;
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, const int32 MinNeighborCount = 1) const;
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, const TSet<int32>& Exclusion, const int32 MinNeighborCount = 1) const;
@@ -438,6 +454,17 @@ namespace PCGExClusters
 
 		void GetValidEdges(TArray<FEdge>& OutValidEdges) const;
 
+		/** Whether the fully valid edges (see GetValidEdges) still connect every node into a single component. */
+		bool AreValidEdgesConnected() const;
+
+		/**
+		 * Drops every edge that isn't fully valid, remapping edge indices and node links so the cluster matches an
+		 * edge output written with InheritPoints(OutEdgeMask). Node indices are preserved, so every node must keep at
+		 * least one edge; returns false and leaves the cluster untouched otherwise.
+		 * Node & edge arrays are reallocated rather than edited in place, since they may be shared with a mirror.
+		 */
+		bool CompactEdges(TBitArray<>& OutEdgeMask);
+
 		int32 FindClosestNeighborInDirection(const int32 NodeIndex, const FVector& Direction, int32 MinNeighborCount = 1) const;
 
 		TSharedPtr<TArray<FBoundedEdge>> GetBoundedEdges(const bool bBuild);
@@ -0,0 +1,54 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+/**
+ * Optional on-disk cache of cluster topology, persisting across editor sessions and cooks.
+ * Entries are keyed by a content hash of the vtx/edge endpoint attributes (VData/EData), so positions can change
+ * freely without invalidating them. Only topology is stored (nodes, links, edge endpoints); bounds and anything
+ * position-dependent are recomputed on load.
+ * Disabled by default, see pcgex.Clusters.DiskCache.*
+ */
+namespace PCGExClusters::DiskCache
+{
+	/** Bumped whenever the file layout or the way topology is derived changes; part of every key. */
+	constexpr uint32 FormatVersion = 1;
+
+	PCGEXCORE_API bool IsEnabled();
+	PCGEXCORE_API bool IsValidating();
+
+	PCGEXCORE_API FString GetCacheDirectory();
+
+	/** Content key for a vtx/edges pair, 0 if the data is missing its cluster attributes. */
+	PCGEXCORE_API uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO);
+
+	/** Fills a freshly constructed cluster from the entry. Corrupted or mismatching entries are deleted. */
+	PCGEXCORE_API bool Load(FCluster& InCluster, const uint64 InKey);
+	PCGEXCORE_API bool Store(const FCluster& InCluster, const uint64 InKey);
+
+	/** Same nodes, links and edge endpoints, in the same order. */
+	PCGEXCORE_API bool HasSameTopology(const FCluster& A, const FCluster& B);
+
+	/** Deletes least recently used entries until the cache fits in InMaxBytes. */
+	PCGEXCORE_API void Evict(const int64 InMaxBytes);
+	PCGEXCORE_API void Clear();
+
+	/**
+	 * Drop-in for FCluster::BuildFrom: loads the topology from disk when available, builds and stores it otherwise.
+	 * In validation mode the cluster is always built, and the entry is cross-checked against it.
+	 */
+	PCGEXCORE_API bool BuildFrom(const TSharedRef<FCluster>& InCluster, const TMap<uint32, int32>& InEndpointsLookup, const TArray<int32>* InExpectedAdjacency);
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+
+	/**
+	 * Bounding volume hierarchy over edge segments.
+	 * Unlike the edge octree, which culls on each edge's (possibly huge) bounding box and only visits octree nodes
+	 * around the query point, closest queries here are exact: subtrees are pruned against the best point-segment
+	 * distance found so far. Built lazily through FCluster::GetEdgeBVH and cached on the cluster.
+	 */
+	class PCGEXCORE_API FEdgeBVH : public ICachedClusterData
+	{
+	public:
+		static inline const FName CacheKey = FName("EdgeSegmentBVH");
+
+		/** Max edges per leaf */
+		static constexpr int32 LeafSize = 4;
+
+		struct FBVHNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // Leaf: first entry in Order. Internal: index of the right child (left child is this + 1)
+			int32 Count = 0; // Leaf: number of edges. Internal: 0
+
+			FORCEINLINE bool IsLeaf() const { return Count > 0; }
+		};
+
+		explicit FEdgeBVH(const FCluster* InCluster);
+
+		int32 Num() const { return Starts.Num(); }
+
+		/**
+		 * Closest edge to Position, -1 if no edge passes the filter.
+		 * @param Filter bool(int32 EdgeIndex), only evaluated on edges closer than the best so far
+		 */
+		template <typename FilterFunc>
+		int32 FindClosestEdge(const FVector& Position, double& OutDistSquared, FilterFunc&& Filter) const
+		{
+			OutDistSquared = MAX_dbl;
+			int32 Best = -1;
+
+			if (Nodes.IsEmpty()) { return Best; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+				const FBVHNode& Node = Nodes[NodeIndex];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Position) >= OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const int32 EdgeIndex = Order[i];
+						const double Dist = FMath::PointDistToSegmentSquared(Position, Starts[EdgeIndex], Ends[EdgeIndex]);
+						if (Dist < OutDistSquared && Filter(EdgeIndex))
+						{
+							OutDistSquared = Dist;
+							Best = EdgeIndex;
+						}
+					}
+					continue;
+				}
+
+				// Push the farther child first so the nearer one is visited next and tightens the bound early
+				const int32 Left = NodeIndex + 1;
+				const int32 Right = Node.Start;
+				const double DistLeft = Nodes[Left].Bounds.ComputeSquaredDistanceToPoint(Position);
+				const double DistRight = Nodes[Right].Bounds.ComputeSquaredDistanceToPoint(Position);
+
+				if (DistLeft < DistRight)
+				{
+					Stack.Add(Right);
+					Stack.Add(Left);
+				}
+				else
+				{
+					Stack.Add(Left);
+					Stack.Add(Right);
+				}
+			}
+
+			return Best;
+		}
+
+		int32 FindClosestEdge(const FVector& Position, double& OutDistSquared) const
+		{
+			return FindClosestEdge(Position, OutDistSquared, [](const int32) { return true; });
+		}
+
+		/** Batched closest queries, parallel over positions. OutEdges is resized to match. */
+		void FindClosestEdges(TConstArrayView<FVector> Positions, TArray<int32>& OutEdges, const FCluster* InCluster = nullptr, const int32 MinNeighbors = 0) const;
+
+		/**
+		 * Calls Callback(EdgeIndex) for every edge whose segment bounds overlap the box.
+		 * Return false from the callback to stop the search. Returns false if the search was stopped.
+		 */
+		template <typename CallbackFunc>
+		bool ForEachOverlap(const FBox& Box, CallbackFunc&& Callback) const
+		{
+			if (Nodes.IsEmpty()) { return true; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+				const FBVHNode& Node = Nodes[NodeIndex];
+				if (!Node.Bounds.Intersect(Box)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const int32 EdgeIndex = Order[i];
+						if (!GetSegmentBounds(EdgeIndex).Intersect(Box)) { continue; }
+						if (!Callback(EdgeIndex)) { return false; }
+					}
+					continue;
+				}
+
+				Stack.Add(Node.Start);
+				Stack.Add(NodeIndex + 1);
+			}
+
+			return true;
+		}
+
+		FORCEINLINE FBox GetSegmentBounds(const int32 EdgeIndex) const
+		{
+			return FBox(Starts[EdgeIndex].ComponentMin(Ends[EdgeIndex]), Starts[EdgeIndex].ComponentMax(Ends[EdgeIndex]));
+		}
+
+	protected:
+		TArray<FVector> Starts; // Per edge index
+		TArray<FVector> Ends;
+		TArray<int32> Order; // Edge indices, grouped by leaf
+		TArray<FBVHNode> Nodes;
+
+		int32 BuildRecursive(const TArray<FVector>& Centers, const int32 First, const int32 Count);
+	};
+}
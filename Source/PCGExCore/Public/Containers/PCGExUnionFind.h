@@ -0,0 +1,47 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGEx
+{
+	/**
+	 * Lock-free union-find over [0, Num).
+	 * Union always attaches the larger root under the smaller one, so every set converges to its minimum element as
+	 * root regardless of thread interleaving; the final partition and roots are identical to a sequential pass.
+	 * Find & Union are safe to call concurrently. Flatten, GetRoot and Label are not, and expect all unions to be done.
+	 */
+	class PCGEXCORE_API FUnionFind
+	{
+	protected:
+		TArray<int32> Parent;
+
+	public:
+		explicit FUnionFind(const int32 InNum);
+
+		int32 Num() const { return Parent.Num(); }
+
+		/** Root of X, with opportunistic CAS path-halving. */
+		int32 Find(int32 X);
+
+		/** Returns true if A and B were in different sets. */
+		bool Union(int32 A, int32 B);
+
+		/** Points every element directly at its root, so that GetRoot is a single read. Parallel. */
+		void Flatten();
+
+		/** Only valid after Flatten. */
+		FORCEINLINE int32 GetRoot(const int32 X) const { return Parent[X]; }
+		FORCEINLINE bool IsRoot(const int32 X) const { return Parent[X] == X; }
+
+		/**
+		 * Compact set ids, ordered by minimum element, for a flattened forest. Parallel.
+		 * @param OutLabels Per-element set id; -1 for excluded elements.
+		 * @param InIncluded Optional per-element mask. Excluded elements must not have been unioned with included ones.
+		 * @return Number of sets
+		 */
+		int32 Label(TArray<int32>& OutLabels, TConstArrayView<int8> InIncluded = TConstArrayView<int8>()) const;
+	};
+}
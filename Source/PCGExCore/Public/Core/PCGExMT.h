@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExMTCommon.h"
+#include "PCGExMTMainThread.h"
 #include "Async/AsyncWork.h"
 #include "Misc/QueuedThreadPool.h"
 #include "Tasks/Task.h"
@@ -28,6 +29,12 @@ struct FPCGExContext;
 
 namespace PCGExMT
 {
+	namespace Telemetry
+	{
+		class FGroupRecord;
+		class FExecutionRecord;
+	}
+
 	PCGEXCORE_API
 	int32 GetSanitizedBatchSize(const int32 NumIterations, const int32 DesiredBatchSize);
 
@@ -166,6 +173,9 @@ namespace PCGExMT
 		std::atomic<int32> StartedCount{0};
 		std::atomic<int32> CompletedCount{0};
 
+		// Only valid when telemetry is enabled, see PCGExMTTelemetry.h
+		TSharedPtr<Telemetry::FGroupRecord> TelemetryRecord;
+
 	public:
 		using FCreateLaunchablePredicate = std::function<TSharedPtr<FTask>(int32)>;
 
@@ -211,6 +221,11 @@ namespace PCGExMT
 
 		TWeakPtr<FAsyncToken> TryCreateToken(const FName& InName);
 
+		const TSharedPtr<Telemetry::FGroupRecord>& GetTelemetryRecord() const
+		{
+			return TelemetryRecord;
+		}
+
 		virtual void Cancel() override;
 
 	protected:
@@ -225,6 +240,7 @@ namespace PCGExMT
 		void StartHandlesBatchImpl(const TArray<TSharedPtr<FTask>>& InHandles);
 
 		void AssertEmptyThread() const;
+		void RecordScopes(const int32 Count) const;
 	};
 
 	// Token for async work tracking
@@ -256,6 +272,9 @@ namespace PCGExMT
 		mutable FRWLock GroupsLock;
 		TArray<TSharedPtr<FTaskGroup>> Groups;
 
+		// Per-execution telemetry, outlives Reset() so multi-round executions are recorded as a whole
+		TSharedPtr<Telemetry::FExecutionRecord> ExecutionTelemetry;
+
 	public:
 		FEndCallback OnEndCallback;
 		UE::Tasks::ETaskPriority WorkPriority = UE::Tasks::ETaskPriority::Default;
@@ -278,6 +297,11 @@ namespace PCGExMT
 			return Context;
 		}
 
+		const TSharedPtr<Telemetry::FExecutionRecord>& GetTelemetry() const
+		{
+			return ExecutionTelemetry;
+		}
+
 		virtual bool Start() override;
 		virtual void Cancel() override;
 
@@ -338,6 +362,7 @@ namespace PCGExMT
 				OnPrepareSubLoopsCallback(Loops);
 			}
 
+			RecordScopes(NumLoops);
 			Launch(NumLoops, [&](int32 i)
 			{
 				PCGEX_MAKE_SHARED(Task, T, std::forward<Args>(InArgs)...)
@@ -369,11 +394,13 @@ namespace PCGExMT
 		void TriggerSimpleCallback(int32 Index);
 	};
 
+	// Off the game thread, callbacks are batched with every other pending hop and drained once per frame within
+	// a time budget, and held back while UObject work is blocked. See PCGExMTMainThread.h.
 	PCGEXCORE_API
-	void ExecuteOnMainThread(const TSharedPtr<IAsyncHandleGroup>& ParentHandle, FExecuteCallback&& Callback);
+	void ExecuteOnMainThread(const TSharedPtr<IAsyncHandleGroup>& ParentHandle, FExecuteCallback&& Callback, const MainThread::EPriority Priority = MainThread::EPriority::Normal);
 
 	PCGEXCORE_API
-	void ExecuteOnMainThread(FExecuteCallback&& Callback);
+	void ExecuteOnMainThread(FExecuteCallback&& Callback, const MainThread::EPriority Priority = MainThread::EPriority::Normal);
 
 	PCGEXCORE_API
 	void ExecuteOnMainThreadAndWait(FExecuteCallback&& Callback);
@@ -12,6 +12,13 @@ namespace PCGExMT
 	/** Default threshold below which we use sequential execution */
 	inline constexpr int32 DefaultParallelThreshold = 512;
 
+	/**
+	 * Process-wide switch that makes every PCGEx parallel helper and task-group loop run inline.
+	 * Meant for equivalence testing and debugging; also exposed as pcgex.MT.ForceSingleThreaded.
+	 */
+	PCGEXCORE_API bool IsForcedSingleThreaded();
+	PCGEXCORE_API void SetForceSingleThreaded(bool bEnabled);
+
 	/** Function signature for parallel/sequential loop body */
 	using FLoopBody = std::function<void(int32)>;
 
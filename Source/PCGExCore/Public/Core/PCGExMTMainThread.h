@@ -0,0 +1,56 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Game-thread work coalescer.
+ *
+ * Off-thread ExecuteOnMainThread calls used to be one AsyncTask each; with many concurrent graphs that is hundreds
+ * of individual game-thread hops per frame. Callbacks are now queued here and drained in a single batch, highest
+ * priority first, within a per-frame time budget (pcgex.MT.MainThreadBudgetMs). Whatever does not fit, and anything
+ * queued while UObject work is blocked (package save, GC), is deferred to the next frame instead of each caller
+ * having to re-check.
+ */
+namespace PCGExMT::MainThread
+{
+	enum class EPriority : uint8
+	{
+		High = 0, // Unblocks other work (loads, token releases)
+		Normal,
+		Low, // Cosmetic or deferrable (debug, notifications)
+	};
+
+	constexpr int32 NumPriorities = 3;
+
+	struct PCGEXCORE_API FStats
+	{
+		int64 NumQueued = 0;
+		int64 NumExecuted = 0;
+		int32 NumBatches = 0;
+		int32 NumDeferredBatches = 0; // Batches that left work for the next frame (budget or blocked)
+		int32 MaxBatchSize = 0;
+
+		double TotalLatencySeconds = 0; // Queued -> started
+		double MaxLatencySeconds = 0;
+		double BusySeconds = 0;
+
+		double GetAverageLatency() const { return NumExecuted ? TotalLatencySeconds / NumExecuted : 0; }
+	};
+
+	using FCallback = TFunction<void()>;
+
+	/** Queues a callback for the game thread. Thread-safe; does not execute inline, even on the game thread. */
+	PCGEXCORE_API void Enqueue(FCallback&& InCallback, const EPriority InPriority = EPriority::Normal);
+
+	/** Runs queued callbacks until the queue is empty, ignoring the budget. Game thread only; used on shutdown and by headless runners. */
+	PCGEXCORE_API void Flush();
+
+	PCGEXCORE_API int32 GetNumPending();
+
+	PCGEXCORE_API FStats GetStats();
+	PCGEXCORE_API void ResetStats();
+}
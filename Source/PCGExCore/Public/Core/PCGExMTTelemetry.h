@@ -0,0 +1,135 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+struct FPCGExContext;
+
+/**
+ * Opt-in, headless-friendly task telemetry.
+ *
+ * When enabled (pcgex.Telemetry.Enabled=1, or -PCGExTelemetry on the command line as the initial value), every FTaskManager owns an
+ * FExecutionRecord, and every group it creates owns an FGroupRecord. Records are submitted to the global FRegistry
+ * when the manager is released, and can be exported as a Chrome trace (chrome://tracing, Perfetto) and CSV files
+ * with pcgex.Telemetry.Export, or automatically on shutdown with -PCGExTelemetryDir=<Path>.
+ *
+ * Telemetry is disabled by default; when disabled, the only cost is a null check per task.
+ */
+namespace PCGExMT::Telemetry
+{
+	PCGEXCORE_API bool IsEnabled();
+
+	/** Programmatic equivalent of pcgex.Telemetry.Enabled; has no effect on managers that already exist. */
+	PCGEXCORE_API void SetEnabled(const bool bEnabled);
+
+	/** Plain snapshot of a group's statistics. All timestamps are FPlatformTime::Seconds(). */
+	struct PCGEXCORE_API FGroupStats
+	{
+		FName Name = NAME_None;
+		int32 Index = -1;
+		int32 ParentIndex = -1;
+
+		double CreatedAt = 0;
+		double FirstStartAt = 0;
+		double EndAt = 0;
+
+		int32 NumTasks = 0;
+		int32 NumScopes = 0;
+
+		double BusySeconds = 0;        // Summed execution time of all tasks/scopes of this group
+		double QueueDelaySeconds = 0;  // Summed time between a task being launched and starting
+		double MaxQueueDelaySeconds = 0;
+		double IdleSeconds = 0; // Time within the group lifetime where none of its tasks was executing
+
+		int32 MainThreadHops = 0;
+		double MainThreadLatencySeconds = 0; // Summed time between a hop being queued and running on the game thread
+		double MainThreadBusySeconds = 0;
+
+		bool bCancelled = false;
+
+		double GetWallSeconds() const { return EndAt > CreatedAt ? EndAt - CreatedAt : 0; }
+	};
+
+	class PCGEXCORE_API FGroupRecord : public TSharedFromThis<FGroupRecord>
+	{
+		mutable FCriticalSection Lock;
+		FGroupStats Stats;
+
+		int32 ActiveCount = 0;
+		double IdleSince = 0;
+
+	public:
+		FGroupRecord(const FName InName, const int32 InIndex, const int32 InParentIndex);
+
+		int32 GetIndex() const { return Stats.Index; } // Immutable after construction
+
+		void OnTaskStart(const double LaunchedAt, const double StartedAt);
+		void OnTaskEnd(const double StartedAt, const double EndedAt);
+		void AddScopes(const int32 Count);
+		void OnMainThreadHop(const double QueuedAt, const double StartedAt, const double EndedAt);
+		void OnEnd(const bool bWasCancelled);
+
+		FGroupStats GetStats() const;
+	};
+
+	class PCGEXCORE_API FExecutionRecord : public TSharedFromThis<FExecutionRecord>
+	{
+		mutable FCriticalSection Lock;
+		TArray<TSharedPtr<FGroupRecord>> Groups;
+
+	public:
+		uint64 ExecutionId = 0;
+		FString ElementName;
+		FString NodeName;
+		FString SourceName;
+		double StartedAt = 0;
+		double EndedAt = 0;
+
+		explicit FExecutionRecord(const FPCGExContext* InContext);
+
+		TSharedPtr<FGroupRecord> AddGroup(const FName InName, const int32 InParentIndex = -1);
+		void GetGroupStats(TArray<FGroupStats>& OutStats) const;
+	};
+
+	/** Global sink for finished execution records. Bounded by pcgex.Telemetry.MaxExecutions. */
+	class PCGEXCORE_API FRegistry
+	{
+		mutable FCriticalSection Lock;
+		TArray<TSharedPtr<FExecutionRecord>> Executions;
+
+		FRegistry() = default;
+
+	public:
+		static FRegistry& Get();
+
+		void Submit(const TSharedPtr<FExecutionRecord>& InRecord);
+		void Reset();
+		int32 Num() const;
+
+		/** Chrome trace event format; one process per execution, one thread lane per group. */
+		bool ExportChromeTrace(const FString& InFilePath) const;
+
+		/** One row per (execution, group). */
+		bool ExportGroupsCSV(const FString& InFilePath) const;
+
+		/** One row per element, aggregated over all of its recorded executions. */
+		bool ExportElementsCSV(const FString& InFilePath) const;
+
+		/** Writes all of the above into InDirectory. Falls back to <Saved>/PCGEx/Telemetry when empty. */
+		bool ExportAll(const FString& InDirectory = FString()) const;
+
+		void GetExecutions(TArray<TSharedPtr<FExecutionRecord>>& OutExecutions) const;
+
+		/** Exchanges the recorded executions with InOutExecutions; lets a caller record in isolation and put the previous records back. */
+		void SwapExecutions(TArray<TSharedPtr<FExecutionRecord>>& InOutExecutions);
+	};
+
+	/** Called on PCGExCore shutdown; exports if -PCGExTelemetryDir was provided. */
+	PCGEXCORE_API void FlushOnShutdown();
+}
@@ -0,0 +1,92 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGDataCollection;
+class UPCGBasePointData;
+
+namespace PCGExData
+{
+	class FPointIO;
+	class FFacade;
+}
+
+/**
+ * Output-equivalence fingerprints.
+ * Meant to prove that two code paths (parallel vs. sequential, bulk vs. per-element, octree vs. grid...) produce
+ * the same data: point properties, attributes, tags and cluster topology are hashed with quantized floats, so
+ * that bit-level noise below the tolerance does not register as a difference.
+ */
+namespace PCGExFingerprint
+{
+	struct PCGEXCORE_API FOptions
+	{
+		/** Floating-point values are quantized to this step before hashing. */
+		double Tolerance = 1e-3;
+
+		/** Ignore point order (and data order within a pin). Per-point hashes are sorted before being combined. */
+		bool bOrderIndependent = false;
+
+		bool bIncludeProperties = true;
+		bool bIncludeAttributes = true;
+		bool bIncludeTags = true;
+
+		/** Seeds are frequently re-derived from positions or indices; excluded by default. */
+		bool bIncludeSeed = false;
+
+		/** Attributes that legitimately differ between runs. Defaults to the cluster endpoint attributes, which store raw indices. */
+		TSet<FName> IgnoredAttributes;
+
+		FOptions();
+	};
+
+	struct PCGEXCORE_API FFingerprint
+	{
+		FString Label;
+		uint64 Hash = 0;
+		int32 NumPoints = 0;
+
+		/** Per-channel hashes ("$Position", "@MyAttribute", "#Tags", "~Edges"...), used to report what differs. */
+		TArray<TPair<FString, uint64>> Channels;
+
+		/** Per-data fingerprints when computed over a collection. */
+		TArray<FFingerprint> Children;
+
+		bool operator==(const FFingerprint& Other) const { return Hash == Other.Hash; }
+		bool operator!=(const FFingerprint& Other) const { return Hash != Other.Hash; }
+
+		FString ToString() const;
+	};
+
+	PCGEXCORE_API FFingerprint Compute(const UPCGBasePointData* InData, const TSet<FString>* InTags, const FOptions& InOptions);
+
+	/** Uses the output if there is one, the input otherwise. */
+	PCGEXCORE_API FFingerprint Compute(const PCGExData::FPointIO& InPointIO, const FOptions& InOptions);
+
+	/** Buffers must have been written (Flush/WriteFastest) for their values to be visible. */
+	PCGEXCORE_API FFingerprint Compute(const PCGExData::FFacade& InFacade, const FOptions& InOptions);
+
+	/**
+	 * Edge topology of a vtx/edges pair, independent from vtx indices: each edge is hashed from the quantized
+	 * positions of its two endpoints, direction-agnostic.
+	 */
+	PCGEXCORE_API FFingerprint ComputeTopology(const UPCGBasePointData* InVtx, const UPCGBasePointData* InEdges, const FOptions& InOptions);
+
+	/**
+	 * Every point data in the collection, grouped by pin. Edge data paired with a vtx data (through the cluster tag)
+	 * additionally gets its topology hashed.
+	 */
+	PCGEXCORE_API FFingerprint Compute(const FPCGDataCollection& InCollection, const FOptions& InOptions);
+
+	/**
+	 * Settings hash of an object: its class, and the text export of every reflected property declared by InBaseClass or its subclasses
+	 * (all of them if null). Referenced assets are hashed by path, not content.
+	 */
+	PCGEXCORE_API uint64 ComputeSettings(const UObject* InObject, const UClass* InBaseClass = nullptr);
+
+	/** Appends human-readable differences between A and B; returns true if they are equivalent. */
+	PCGEXCORE_API bool Diff(const FFingerprint& A, const FFingerprint& B, TArray<FString>& OutDifferences);
+}
@@ -202,6 +202,14 @@ namespace PCGExMath::Geo
 		TConstArrayView<FVector2D> Outline,
 		float ZMin, float ZMax);
 
+	/**
+	 * Final step of SignedDistanceToPolygonPrism, for callers that resolve the 2D inside test and
+	 * closest-edge distance themselves (e.g. through a spatial index over the outline edges).
+	 */
+	PCGEXCORE_API float CombinePolygonPrismDistance(
+		bool bInside2D, float MinDistSq2D,
+		float LocalZ, float ZMin, float ZMax);
+
 	/**
 	 * World-space AABB of an extruded prism: a 2D outline (in projection-frame XY)
 	 * extruded along the projection-frame Z by [ZMin, ZMax], placed in world via
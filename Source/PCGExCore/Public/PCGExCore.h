@@ -14,6 +14,7 @@ class FPCGExCoreModule final : public IPCGExLegacyModuleInterface
 
 public:
 	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
 
 #if WITH_EDITOR
 	virtual void RegisterToEditor(const TSharedPtr<FSlateStyleSet>& InStyle) override;
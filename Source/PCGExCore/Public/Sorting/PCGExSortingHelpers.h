@@ -85,4 +85,60 @@ namespace PCGExSortingHelpers
 			Swap(Curr, Out);
 		}
 	}
+
+	static void RadixSort(TArray<uint64>& Keys)
+	{
+		const int32 N = Keys.Num();
+		if (N <= 1)
+		{
+			return;
+		}
+
+		constexpr int32 NUM_BUCKETS = 256;
+		constexpr int32 NUM_PASSES = sizeof(uint64);
+
+		TArray<uint64> Temp;
+		Temp.SetNumUninitialized(N);
+
+		uint64* Curr = Keys.GetData();
+		uint64* Out = Temp.GetData();
+
+		for (int32 pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			int32 Count[NUM_BUCKETS] = {};
+			int32 Shift = pass * 8;
+
+			for (int32 i = 0; i < N; ++i)
+			{
+				Count[(Curr[i] >> Shift) & 0xFF]++;
+			}
+
+			// All keys share this byte (i.e high bytes of small packed indices), nothing to move
+			if (Count[(Curr[0] >> Shift) & 0xFF] == N)
+			{
+				continue;
+			}
+
+			int32 Sum[NUM_BUCKETS];
+			int32 s = 0;
+			for (int32 i = 0; i < NUM_BUCKETS; ++i)
+			{
+				Sum[i] = s;
+				s += Count[i];
+			}
+
+			for (int32 i = 0; i < N; ++i)
+			{
+				Out[Sum[(Curr[i] >> Shift) & 0xFF]++] = Curr[i];
+			}
+
+			Swap(Curr, Out);
+		}
+
+		// Skipped passes may leave the result in the scratch buffer
+		if (Curr != Keys.GetData())
+		{
+			FMemory::Memcpy(Keys.GetData(), Curr, N * sizeof(uint64));
+		}
+	}
 }
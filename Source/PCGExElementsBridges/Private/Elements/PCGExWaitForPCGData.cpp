@@ -10,6 +10,7 @@
 #include "PCGGraph.h"
 #include "PCGSubsystem.h"
 #include "Async/Async.h"
+#include "Core/PCGExMT.h"
 #include "Data/PCGExAttributeBroadcaster.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataHelpers.h"
@@ -438,10 +439,172 @@ namespace PCGExWaitForPCGData
 
 	void FComponentDiscovery::Stop()
 	{
+		bIsWaiting = false;
+		UnbindChangeEvents();
+
 		PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
 		PCGEX_ASYNC_RELEASE_TOKEN(SearchComponentsToken)
 	}
 
+	void FComponentDiscovery::WaitForChanges(const double InTimeout)
+	{
+		// May come from an inspection task; events and watchdog live on the game thread
+		PCGEX_SUBSYSTEM
+		PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this)), InTimeout]()
+		{
+			if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+			{
+				This->bIsWaiting = true;
+				This->NextPollTime = FPlatformTime::Seconds() + PollInterval;
+				This->BindChangeEvents();
+				This->Watchdog(++This->WaitSerial, InTimeout);
+			}
+		});
+	}
+
+	void FComponentDiscovery::Watchdog(const int32 InWaitSerial, const double InTimeout)
+	{
+		if (!bIsWaiting || InWaitSerial != WaitSerial)
+		{
+			// Resumed by an event, or superseded by a newer wait
+			return;
+		}
+
+		if (Context->GetWorld()->GetTimeSeconds() - StartTime < InTimeout)
+		{
+			if (SearchComponentsToken.IsValid() && FPlatformTime::Seconds() >= NextPollTime)
+			{
+				// Throttled re-inspection; a new wait is started if components are still missing
+				Resume();
+				return;
+			}
+
+			PCGEX_SUBSYSTEM
+			PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this)), InWaitSerial, InTimeout]()
+			{
+				if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+				{
+					This->Watchdog(InWaitSerial, InTimeout);
+				}
+			});
+			return;
+		}
+
+		// Timed out; one last search, which reports whatever is still missing
+		Resume();
+	}
+
+	void FComponentDiscovery::OnWorldChanged()
+	{
+		if (!bIsWaiting || bResumeScheduled)
+		{
+			return;
+		}
+
+		// Coalesce bursts of spawns (level streaming, WP loading) into a single search next tick
+		bResumeScheduled = true;
+
+		PCGEX_SUBSYSTEM
+		PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
+		{
+			if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+			{
+				This->bResumeScheduled = false;
+				This->Resume();
+			}
+		});
+	}
+
+	void FComponentDiscovery::Resume()
+	{
+		if (!bIsWaiting)
+		{
+			return;
+		}
+
+		bIsWaiting = false;
+
+		if (SearchActorsToken.IsValid())
+		{
+			GatherActors();
+		}
+		else if (SearchComponentsToken.IsValid())
+		{
+			GatherComponents();
+		}
+	}
+
+	void FComponentDiscovery::BindChangeEvents()
+	{
+		check(IsInGameThread());
+
+		if (BoundWorld.IsValid())
+		{
+			return;
+		}
+
+		UWorld* World = Context->GetWorld();
+		if (!World)
+		{
+			return;
+		}
+
+		BoundWorld = World;
+
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda(
+			[WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))](AActor*)
+			{
+				if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+				{
+					This->OnWorldChanged();
+				}
+			}));
+
+		LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddLambda(
+			[WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this)), WeakWorld = BoundWorld](ULevel*, UWorld* InWorld)
+			{
+				if (InWorld != WeakWorld.Get())
+				{
+					return;
+				}
+
+				if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+				{
+					This->OnWorldChanged();
+				}
+			});
+	}
+
+	void FComponentDiscovery::UnbindChangeEvents()
+	{
+		if (!ActorSpawnedHandle.IsValid() && !LevelAddedHandle.IsValid())
+		{
+			return;
+		}
+
+		auto Unbind = [WeakWorld = BoundWorld, ActorSpawned = ActorSpawnedHandle, LevelAdded = LevelAddedHandle]()
+		{
+			if (UWorld* World = WeakWorld.Get())
+			{
+				World->RemoveOnActorSpawnedHandler(ActorSpawned);
+			}
+			FWorldDelegates::LevelAddedToWorld.Remove(LevelAdded);
+		};
+
+		BoundWorld.Reset();
+		ActorSpawnedHandle.Reset();
+		LevelAddedHandle.Reset();
+
+		if (IsInGameThread())
+		{
+			Unbind();
+		}
+		else
+		{
+			PCGExMT::ExecuteOnMainThread(MoveTemp(Unbind));
+		}
+	}
+
 	void FComponentDiscovery::GatherActors()
 	{
 		if (!SearchActorsToken.IsValid())
@@ -475,14 +638,7 @@ namespace PCGExWaitForPCGData
 		{
 			if (Context->GetWorld()->GetTimeSeconds() - StartTime < TimeoutConfig.WaitForActorTimeout)
 			{
-				PCGEX_SUBSYSTEM
-				PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
-				{
-					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
-					{
-						This->GatherActors();
-					}
-				});
+				WaitForChanges(TimeoutConfig.WaitForActorTimeout);
 				return;
 			}
 
@@ -675,14 +831,7 @@ namespace PCGExWaitForPCGData
 		{
 			if (Context->GetWorld()->GetTimeSeconds() - StartTime < TimeoutConfig.WaitForComponentTimeout)
 			{
-				PCGEX_SUBSYSTEM
-				PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
-				{
-					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
-					{
-						This->GatherComponents();
-					}
-				});
+				WaitForChanges(TimeoutConfig.WaitForComponentTimeout);
 				return;
 			}
 
@@ -4,9 +4,12 @@
 #include "Helpers/PCGExPCGGenerationWatcher.h"
 
 #include "PCGComponent.h"
+#include "PCGExSubSystem.h"
 #include "PCGSubsystem.h"
 #include "Core/PCGExMT.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
 #include "Utils/PCGExIntTracker.h"
 
 #pragma region FGenerationConfig
@@ -134,6 +137,270 @@ bool PCGExPCGInterop::FGenerationConfig::TriggerGeneration(UPCGComponent* Compon
 
 #pragma endregion
 
+#pragma region FGenerationRegistry
+
+namespace PCGExPCGInterop
+{
+	/**
+	 * Per-world registry of components being waited on. Game thread only.
+	 * Each component is bound once to its generated/cancelled/cleaned delegates no matter how many watchers
+	 * wait on it, and unbound as soon as it reports, so nothing lingers on the component afterward.
+	 * A throttled watchdog catches components destroyed without broadcasting.
+	 */
+	class FGenerationRegistry
+	{
+	public:
+		static void Subscribe(UPCGComponent* InComponent, const TSharedRef<FGenerationWatcher>& InWatcher)
+		{
+			check(IsInGameThread());
+
+			UWorld* World = InComponent->GetWorld();
+			if (!World)
+			{
+				InWatcher->OnComponentLost();
+				return;
+			}
+
+			BindWorldCleanup();
+
+			FWorldEntries& WorldEntries = GetRegistry().FindOrAdd(World);
+			FEntry& Entry = WorldEntries.Entries.FindOrAdd(InComponent);
+
+			if (!Entry.Component.IsValid())
+			{
+				Entry.Component = InComponent;
+				Entry.GeneratedHandle = InComponent->OnPCGGraphGeneratedDelegate.AddStatic(&FGenerationRegistry::OnGenerated);
+				Entry.CancelledHandle = InComponent->OnPCGGraphCancelledDelegate.AddStatic(&FGenerationRegistry::OnCancelled);
+				Entry.CleanedHandle = InComponent->OnPCGGraphCleanedDelegate.AddStatic(&FGenerationRegistry::OnCleaned);
+			}
+
+			Entry.Watchers.Add(InWatcher);
+
+			ScheduleWatchdog(World, WorldEntries);
+		}
+
+	private:
+		/** Seconds between watchdog sweeps; events do the actual work. */
+		static constexpr double WatchdogInterval = 0.5;
+
+		struct FEntry
+		{
+			TWeakObjectPtr<UPCGComponent> Component;
+			FDelegateHandle GeneratedHandle;
+			FDelegateHandle CancelledHandle;
+			FDelegateHandle CleanedHandle;
+			TArray<TWeakPtr<FGenerationWatcher>> Watchers;
+		};
+
+		struct FWorldEntries
+		{
+			TMap<TObjectKey<UPCGComponent>, FEntry> Entries;
+			double NextWatchdogTime = 0;
+			bool bWatchdogScheduled = false;
+		};
+
+		static TMap<TObjectKey<UWorld>, FWorldEntries>& GetRegistry()
+		{
+			static TMap<TObjectKey<UWorld>, FWorldEntries> Registry;
+			return Registry;
+		}
+
+		static void BindWorldCleanup()
+		{
+			static bool bBound = false;
+			if (bBound)
+			{
+				return;
+			}
+
+			bBound = true;
+			FWorldDelegates::OnWorldCleanup.AddStatic(&FGenerationRegistry::OnWorldCleanup);
+		}
+
+		static void Unbind(FEntry& Entry)
+		{
+			if (UPCGComponent* Component = Entry.Component.Get())
+			{
+				Component->OnPCGGraphGeneratedDelegate.Remove(Entry.GeneratedHandle);
+				Component->OnPCGGraphCancelledDelegate.Remove(Entry.CancelledHandle);
+				Component->OnPCGGraphCleanedDelegate.Remove(Entry.CleanedHandle);
+			}
+		}
+
+		static void OnGenerated(UPCGComponent* InComponent)
+		{
+			Dispatch(InComponent, true);
+		}
+
+		static void OnCancelled(UPCGComponent* InComponent)
+		{
+			Dispatch(InComponent, false);
+		}
+
+		static void OnCleaned(UPCGComponent* InComponent)
+		{
+			// Forced generations clean up first; only a cleanup that isn't part of a generation ends the wait
+			if (!InComponent->IsGenerating())
+			{
+				Dispatch(InComponent, false);
+			}
+		}
+
+		static void Dispatch(UPCGComponent* InComponent, const bool bSuccess)
+		{
+			FEntry Entry;
+			bool bFound = false;
+
+			if (FWorldEntries* WorldEntries = GetRegistry().Find(InComponent->GetWorld()))
+			{
+				bFound = WorldEntries->Entries.RemoveAndCopyValue(InComponent, Entry);
+			}
+
+			if (!bFound)
+			{
+				return;
+			}
+
+			Unbind(Entry);
+
+			// Watchers were moved out of the registry; callbacks are free to subscribe again
+			for (const TWeakPtr<FGenerationWatcher>& WeakWatcher : Entry.Watchers)
+			{
+				if (TSharedPtr<FGenerationWatcher> Watcher = WeakWatcher.Pin())
+				{
+					Watcher->OnComponentReady(InComponent, bSuccess);
+				}
+			}
+		}
+
+		static void NotifyLost(FEntry& Entry)
+		{
+			Unbind(Entry);
+
+			for (const TWeakPtr<FGenerationWatcher>& WeakWatcher : Entry.Watchers)
+			{
+				if (TSharedPtr<FGenerationWatcher> Watcher = WeakWatcher.Pin())
+				{
+					Watcher->OnComponentLost();
+				}
+			}
+		}
+
+		static void ScheduleWatchdog(UWorld* InWorld, FWorldEntries& WorldEntries)
+		{
+			if (WorldEntries.bWatchdogScheduled)
+			{
+				return;
+			}
+
+			UPCGExSubSystem* PCGExSubsystem = UPCGExSubSystem::GetInstance(InWorld);
+			if (!PCGExSubsystem)
+			{
+				return;
+			}
+
+			WorldEntries.bWatchdogScheduled = true;
+			PCGExSubsystem->RegisterBeginTickAction([WorldKey = TObjectKey<UWorld>(InWorld)]()
+			{
+				RunWatchdog(WorldKey);
+			});
+		}
+
+		static void RunWatchdog(const TObjectKey<UWorld>& WorldKey)
+		{
+			FWorldEntries* WorldEntries = GetRegistry().Find(WorldKey);
+			if (!WorldEntries)
+			{
+				return;
+			}
+
+			WorldEntries->bWatchdogScheduled = false;
+
+			const double Now = FPlatformTime::Seconds();
+			if (Now >= WorldEntries->NextWatchdogTime)
+			{
+				WorldEntries->NextWatchdogTime = Now + WatchdogInterval;
+
+				TArray<FEntry> Lost;
+				TArray<UPCGComponent*> Settled;
+
+				for (auto It = WorldEntries->Entries.CreateIterator(); It; ++It)
+				{
+					FEntry& Entry = It.Value();
+					Entry.Watchers.RemoveAll([](const TWeakPtr<FGenerationWatcher>& Watcher)
+					{
+						return !Watcher.IsValid();
+					});
+
+					UPCGComponent* Component = Entry.Component.Get();
+
+					if (Entry.Watchers.IsEmpty())
+					{
+						// Nobody is waiting anymore
+						Unbind(Entry);
+						It.RemoveCurrent();
+					}
+					else if (!Component)
+					{
+						Lost.Add(MoveTemp(Entry));
+						It.RemoveCurrent();
+					}
+					else if (!Component->IsGenerating())
+					{
+						// Settled without us hearing about it
+						Settled.Add(Component);
+					}
+				}
+
+				for (FEntry& Entry : Lost)
+				{
+					NotifyLost(Entry);
+				}
+
+				for (UPCGComponent* Component : Settled)
+				{
+					Dispatch(Component, true);
+				}
+
+				// Callbacks may have touched the registry
+				WorldEntries = GetRegistry().Find(WorldKey);
+			}
+
+			if (!WorldEntries)
+			{
+				return;
+			}
+
+			if (WorldEntries->Entries.IsEmpty())
+			{
+				GetRegistry().Remove(WorldKey);
+				return;
+			}
+
+			if (UWorld* World = WorldKey.ResolveObjectPtr())
+			{
+				ScheduleWatchdog(World, *WorldEntries);
+			}
+		}
+
+		static void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+		{
+			FWorldEntries WorldEntries;
+			if (!GetRegistry().RemoveAndCopyValue(InWorld, WorldEntries))
+			{
+				return;
+			}
+
+			for (TPair<TObjectKey<UPCGComponent>, FEntry>& Pair : WorldEntries.Entries)
+			{
+				NotifyLost(Pair.Value);
+			}
+		}
+	};
+}
+
+#pragma endregion
+
 #pragma region FGenerationWatcher
 
 PCGExPCGInterop::FGenerationWatcher::FGenerationWatcher(
@@ -185,12 +452,19 @@ PCGExPCGInterop::FGenerationWatcher::~FGenerationWatcher()
 }
 
 #if WITH_EDITOR
-void PCGExPCGInterop::FGenerationWatcher::ReleaseIgnoredOrigins(UPCGComponent* ForSource)
+void PCGExPCGInterop::FGenerationWatcher::ReleaseIgnoredOrigins(UPCGComponent* ForSource, const bool bStaleOnly)
 {
 	for (int32 i = IgnoredOrigins.Num() - 1; i >= 0; --i)
 	{
 		const FIgnoredOrigin& Entry = IgnoredOrigins[i];
-		if (ForSource && Entry.Source.Get() != ForSource)
+		if (bStaleOnly)
+		{
+			if (Entry.Source.IsValid())
+			{
+				continue;
+			}
+		}
+		else if (ForSource && Entry.Source.Get() != ForSource)
 		{
 			continue;
 		}
@@ -292,23 +566,8 @@ void PCGExPCGInterop::FGenerationWatcher::WatchComponentGeneration(UPCGComponent
 			return;
 		}
 
-		// Watch for cancellation
-		Component->OnPCGGraphCancelledDelegate.AddLambda([WeakWatcher](UPCGComponent* InComp)
-		{
-			if (TSharedPtr<FGenerationWatcher> NestedWatcher = WeakWatcher.Pin())
-			{
-				NestedWatcher->OnComponentReady(InComp, false);
-			}
-		});
-
-		// Watch for completion
-		Component->OnPCGGraphGeneratedDelegate.AddLambda([WeakWatcher](UPCGComponent* InComp)
-		{
-			if (TSharedPtr<FGenerationWatcher> NestedWatcher = WeakWatcher.Pin())
-			{
-				NestedWatcher->OnComponentReady(InComp, true);
-			}
-		});
+		// Completion, cancellation or cleanup will call us back
+		FGenerationRegistry::Subscribe(Component, Watcher.ToSharedRef());
 	});
 }
 
@@ -327,4 +586,13 @@ void PCGExPCGInterop::FGenerationWatcher::OnComponentReady(UPCGComponent* InComp
 	WatcherTracker->IncrementCompleted();
 }
 
+void PCGExPCGInterop::FGenerationWatcher::OnComponentLost()
+{
+#if WITH_EDITOR
+	ReleaseIgnoredOrigins(nullptr, true);
+#endif
+
+	WatcherTracker->IncrementCompleted();
+}
+
 #pragma endregion
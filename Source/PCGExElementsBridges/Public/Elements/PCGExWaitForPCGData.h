@@ -329,6 +329,17 @@ namespace PCGExWaitForPCGData
 		void Inspect(int32 Index);
 		void OnInspectionCompleteInternal();
 
+		// Missing actors/components are waited on through world events (actor spawned, level added).
+		// Components added to, or regraphed on, already-queued actors raise no such event, so while waiting
+		// on components the begin-tick watchdog also re-inspects the queued actors every PollInterval.
+		// It runs one last search when the timeout expires.
+		void WaitForChanges(const double InTimeout);
+		void Watchdog(const int32 InWaitSerial, const double InTimeout);
+		void OnWorldChanged();
+		void Resume();
+		void BindChangeEvents();
+		void UnbindChangeEvents();
+
 		bool IsValidCandidate(const UPCGComponent* Candidate) const;
 		bool HasRequiredPins(const UPCGGraph* CandidateGraph) const;
 
@@ -349,8 +360,19 @@ namespace PCGExWaitForPCGData
 		TArray<AActor*> QueuedActors;
 		TArray<TArray<UPCGComponent*>> PerActorGatheredComponents;
 
+		TWeakObjectPtr<UWorld> BoundWorld;
+		FDelegateHandle ActorSpawnedHandle;
+		FDelegateHandle LevelAddedHandle;
+		int32 WaitSerial = 0;
+		double NextPollTime = 0;
+		bool bIsWaiting = false;
+		bool bResumeScheduled = false;
+
 		FOnDiscoveryComplete OnComponentFound;
 		TFunction<void()> OnDiscoveryComplete;
+
+		/** Seconds between re-inspections of the queued actors while waiting on components. */
+		static constexpr double PollInterval = 0.5;
 	};
 
 	//
@@ -51,12 +51,18 @@ namespace PCGExPCGInterop
 		bool TriggerGeneration(UPCGComponent* Component, bool& bOutShouldWatch, UPCGComponent* InSelf, AActor*& OutIgnoredOwner) const;
 	};
 
+	class FGenerationRegistry;
+
 	/**
 	 * Watches PCG components for generation completion.
 	 * Handles triggering generation and waiting for completion via callbacks.
+	 * Completion is event-driven: watched components are subscribed through a per-world registry
+	 * (see FGenerationRegistry), which only polls as a low-frequency watchdog for components that go away silently.
 	 */
 	class PCGEXELEMENTSBRIDGES_API FGenerationWatcher final : public TSharedFromThis<FGenerationWatcher>
 	{
+		friend class FGenerationRegistry;
+
 	public:
 		using FOnGenerationComplete = TFunction<void(UPCGComponent*, bool bSuccess)>;
 
@@ -87,10 +93,14 @@ namespace PCGExPCGInterop
 		void WatchComponentGeneration(UPCGComponent* InComponent);
 		void OnComponentReady(UPCGComponent* InComponent, bool bSuccess);
 
+		// A watched component was destroyed (or its world torn down) before reporting.
+		void OnComponentLost();
+
 #if WITH_EDITOR
 		// Releases the ignore brackets opened in ProcessComponent. ForSource==null sweeps all
 		// outstanding entries (destructor / cancellation), keeping the engine's ignore counter balanced.
-		void ReleaseIgnoredOrigins(UPCGComponent* ForSource);
+		// bStaleOnly restricts the sweep to entries whose source component no longer exists.
+		void ReleaseIgnoredOrigins(UPCGComponent* ForSource, bool bStaleOnly = false);
 
 		struct FIgnoredOrigin
 		{
@@ -7,8 +7,10 @@
 #include "PCGExVersion.h"
 #include "PCGParamData.h"
 #include "Async/ParallelFor.h"
+#include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExClusterFilter.h"
 #include "Data/PCGExData.h"
+#include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Graphs/PCGExGraph.h"
 #include "Graphs/PCGExGraphBuilder.h"
@@ -439,12 +441,7 @@ namespace PCGExRefineEdges
 	void FProcessor::ProcessEdges(const PCGExMT::FScope& Scope)
 	{
 		PrepareSingleLoopScopeForEdges(Scope);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(Index);
-			Refinement->ProcessEdge(Edge);
-		}
+		Refinement->ProcessEdgeScope(Scope);
 	}
 
 	void FProcessor::OnEdgesProcessingComplete()
@@ -540,7 +537,7 @@ namespace PCGExRefineEdges
 		}
 	}
 
-	void FProcessor::InsertEdges() const
+	void FProcessor::InsertEdges()
 	{
 		if (Settings->Mode == EPCGExRefineEdgesOutput::Attribute)
 		{
@@ -628,15 +625,93 @@ namespace PCGExRefineEdges
 				return;
 			}
 
-			TArray<PCGExGraphs::FEdge> ValidEdges;
-			Cluster->GetValidEdges(ValidEdges);
+			const FPCGExGraphBuilderDetails& Details = Context->GraphBuilderDetails;
+			bCanUpdateInPlace = false;
 
-			if (ValidEdges.IsEmpty())
+			if (Settings->bUpdateInPlace && !Details.bRefreshEdgeSeed && !Details.bOutputEdgeLength && !Details.bPreBuildFaceEnumerator && !Details.bPreBuildChains)
 			{
-				return;
+				int32 NumValidEdges = 0;
+				for (const PCGExGraphs::FEdge& Edge : *Cluster->Edges) { NumValidEdges += Cluster->IsEdgeFullyValid(Edge); }
+
+				bTopologyChanged = NumValidEdges != Cluster->Edges->Num();
+
+				// A compile would prune vtx left without edges and split disconnected parts into separate clusters;
+				// as long as neither happens, the output topology is the input one minus the removed edges.
+				bCanUpdateInPlace = NumValidEdges > 0 &&
+					(!bTopologyChanged || Cluster->AreValidEdgesConnected()) &&
+					Details.IsValid(Cluster->Nodes->Num(), NumValidEdges);
 			}
 
-			GraphBuilder->Graph->InsertEdges(ValidEdges);
+			// Graph insertion is deferred to the batch, which only knows whether the whole vtx group can be updated in place once every cluster is done
+			if (!bCanUpdateInPlace) { InsertGraphEdges(); }
+		}
+	}
+
+	void FProcessor::InsertGraphEdges() const
+	{
+		TArray<PCGExGraphs::FEdge> ValidEdges;
+		Cluster->GetValidEdges(ValidEdges);
+
+		if (ValidEdges.IsEmpty())
+		{
+			return;
+		}
+
+		GraphBuilder->Graph->InsertEdges(ValidEdges);
+	}
+
+	void FProcessor::UpdateInPlace(const TSharedPtr<PCGExData::TBuffer<int64>>& VtxEndpointWriter, const PCGExDataId& PairId)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExRefineEdges::UpdateInPlace);
+
+		const TSharedRef<PCGExData::FPointIO>& EdgeIO = EdgeDataFacade->Source;
+
+		if (bTopologyChanged)
+		{
+			TBitArray<> EdgeMask;
+			verify(Cluster->CompactEdges(EdgeMask)); // Connectivity was checked, every node keeps at least one edge
+
+			EdgeIO->InitializeOutput(PCGExData::EIOInit::New);
+			(void)EdgeIO->InheritPoints(EdgeMask, false);
+		}
+		else
+		{
+			EdgeIO->InitializeOutput(PCGExData::EIOInit::Duplicate);
+		}
+
+		PCGExClusters::Helpers::MarkClusterEdges(EdgeIO, PairId);
+
+		// Vtx keep their point index, hence their hash; only the adjacency count may have changed
+		for (const PCGExClusters::FNode& Node : *Cluster->Nodes)
+		{
+			const uint32 VtxHash = PCGEx::H64A(VtxEndpointWriter->GetValue(Node.PointIndex));
+			VtxEndpointWriter->SetValue(Node.PointIndex, PCGEx::H64(VtxHash, Node.Num()));
+		}
+
+		const FPCGExGraphBuilderDetails& Details = Context->GraphBuilderDetails;
+
+		if (Details.bWriteEdgePosition)
+		{
+			EPCGPointNativeProperties AllocateProperties = EPCGPointNativeProperties::Transform;
+			if (Details.BasicEdgeSolidification.SolidificationAxis != EPCGExMinimalAxis::None)
+			{
+				AllocateProperties |= EPCGPointNativeProperties::BoundsMin;
+				AllocateProperties |= EPCGPointNativeProperties::BoundsMax;
+			}
+
+			EdgeIO->GetOut()->AllocateProperties(AllocateProperties);
+
+			for (const PCGExGraphs::FEdge& Edge : *Cluster->Edges)
+			{
+				PCGExData::FMutablePoint EdgePt = EdgeDataFacade->GetOutPoint(Edge.PointIndex);
+				Details.BasicEdgeSolidification.Mutate(EdgePt, VtxDataFacade->GetOutPoint(Edge.Start), VtxDataFacade->GetOutPoint(Edge.End), Details.EdgePosition);
+			}
+		}
+
+		if (Details.WantsClusters())
+		{
+			// Cluster now matches the output edges 1:1
+			ForwardCluster();
 		}
 	}
 
@@ -688,6 +763,92 @@ namespace PCGExRefineEdges
 		TBatch<FProcessor>::OnProcessingPreparationComplete();
 	}
 
+	void FBatch::CompileGraphBuilder(const bool bOutputToContext)
+	{
+		PCGEX_CHECK_WORK_HANDLE_OR_VOID(!GraphBuilder || !bIsBatchValid)
+
+		bool bUpdateInPlace = !Processors.IsEmpty();
+		for (const TSharedRef<PCGExClusterMT::IProcessor>& P : Processors)
+		{
+			if (!P->bIsProcessorValid || !StaticCastSharedRef<FProcessor>(P)->CanUpdateInPlace())
+			{
+				bUpdateInPlace = false;
+				break;
+			}
+		}
+
+		if (!bUpdateInPlace)
+		{
+			// Some clusters held back their edges hoping for an in-place update
+			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, DeferredInsertion)
+
+			DeferredInsertion->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, bOutputToContext]()
+			{
+				PCGEX_ASYNC_THIS
+				This->TBatch<FProcessor>::CompileGraphBuilder(bOutputToContext);
+			};
+
+			DeferredInsertion->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				const TSharedPtr<FProcessor> Processor = This->GetProcessor<FProcessor>(Index);
+				if (Processor->bIsProcessorValid && Processor->CanUpdateInPlace()) { Processor->InsertGraphEdges(); }
+			};
+
+			DeferredInsertion->StartIterations(Processors.Num(), 1, false);
+			return;
+		}
+
+		const TSharedRef<PCGExData::FPointIO>& VtxIO = VtxDataFacade->Source;
+		if (!VtxIO->InitializeOutput(PCGExData::EIOInit::Duplicate))
+		{
+			bIsBatchValid = false;
+			return;
+		}
+
+		const PCGExDataId PairId = VtxIO->Tags->Set<int64>(PCGExClusters::Labels::TagStr_PCGExCluster, VtxIO->GetOut()->GetUniqueID());
+		PCGExClusters::Helpers::MarkClusterVtx(VtxIO, PairId);
+
+		const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpointWriter = VtxDataFacade->GetWritable<int64>(PCGExClusters::Labels::Attr_PCGExVtxIdx, 0, false, PCGExData::EBufferInit::Inherit);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, UpdateInPlace)
+
+		UpdateInPlace->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, bOutputToContext]()
+		{
+			PCGEX_ASYNC_THIS
+
+			This->VtxDataFacade->WriteFastest(This->TaskManager);
+
+			if (!bOutputToContext)
+			{
+				return;
+			}
+
+			const TSharedPtr<PCGExData::FPointIOCollection> OutCollection = This->GraphEdgeOutputCollection.Pin();
+			for (int i = 0; i < This->Processors.Num(); i++)
+			{
+				const TSharedRef<PCGExData::FPointIO>& EdgeIO = This->Processors[i]->EdgeDataFacade->Source;
+				if (OutCollection)
+				{
+					OutCollection->Add(EdgeIO);
+					EdgeIO->IOIndex = This->VtxDataFacade->Source->IOIndex * 100000 + i;
+				}
+				else
+				{
+					EdgeIO->StageOutput(This->ExecutionContext);
+				}
+			}
+		};
+
+		UpdateInPlace->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE, VtxEndpointWriter, PairId](const int32 Index, const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->GetProcessor<FProcessor>(Index)->UpdateInPlace(VtxEndpointWriter, PairId);
+		};
+
+		UpdateInPlace->StartIterations(Processors.Num(), 1, false);
+	}
+
 	void FBatch::Write()
 	{
 		VtxDataFacade->WriteFastest(TaskManager);
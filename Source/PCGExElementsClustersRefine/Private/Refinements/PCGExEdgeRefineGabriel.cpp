@@ -32,6 +32,74 @@ void FPCGExEdgeRefineGabriel::ProcessEdge(PCGExGraphs::FEdge& Edge)
 	});
 }
 
+void FPCGExEdgeRefineGabriel::ProcessEdgeScope(const PCGExMT::FScope& Scope)
+{
+	TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+
+	// Packet diametral spheres, SoA so the per-node test below vectorizes across the packet
+	double CX[EdgePacketSize];
+	double CY[EdgePacketSize];
+	double CZ[EdgePacketSize];
+	double SqrDists[EdgePacketSize];
+	int8 Hits[EdgePacketSize];
+
+	for (int32 PacketStart = Scope.Start; PacketStart < Scope.End; PacketStart += EdgePacketSize)
+	{
+		const int32 Count = FMath::Min(EdgePacketSize, Scope.End - PacketStart);
+
+		FBox PacketBox(ForceInit);
+		double SumVolume = 0;
+
+		for (int32 k = 0; k < Count; k++)
+		{
+			const PCGExGraphs::FEdge& Edge = Edges[PacketStart + k];
+			const FVector From = Cluster->GetStartPos(Edge);
+			const FVector Center = FMath::Lerp(From, Cluster->GetEndPos(Edge), 0.5);
+			const double SqrDist = FVector::DistSquared(Center, From);
+
+			CX[k] = Center.X;
+			CY[k] = Center.Y;
+			CZ[k] = Center.Z;
+			SqrDists[k] = SqrDist;
+			Hits[k] = 0;
+
+			const FBox SphereBox = FBoxCenterAndExtent(Center, FVector(FMath::Sqrt(SqrDist))).GetBox();
+			PacketBox += SphereBox;
+			SumVolume += SphereBox.GetVolume();
+		}
+
+		if (PacketBox.GetVolume() > SumVolume * PacketCoherenceRatio)
+		{
+			for (int32 k = 0; k < Count; k++) { ProcessEdge(Edges[PacketStart + k]); }
+			continue;
+		}
+
+		// One query for the whole packet; the octree is only a prefilter, the strict
+		// in-sphere test is the same as the per-edge path.
+		int32 NumHits = 0;
+		Cluster->NodeOctree->FindFirstElementWithBoundsTest(FBoxCenterAndExtent(PacketBox), [&](const PCGExOctree::FItem& Item)
+		{
+			const FVector Pos = Cluster->GetPos(Item.Index);
+
+			NumHits = 0;
+			for (int32 k = 0; k < Count; k++)
+			{
+				Hits[k] |= (FMath::Square(CX[k] - Pos.X) + FMath::Square(CY[k] - Pos.Y) + FMath::Square(CZ[k] - Pos.Z)) < SqrDists[k];
+				NumHits += Hits[k];
+			}
+
+			return NumHits < Count;
+		});
+
+		if (!NumHits) { continue; }
+
+		for (int32 k = 0; k < Count; k++)
+		{
+			if (Hits[k]) { FPlatformAtomics::InterlockedExchange(&Edges[PacketStart + k].bValid, ExchangeValue); }
+		}
+	}
+}
+
 #pragma endregion
 
 #pragma region UPCGExEdgeRefineGabriel
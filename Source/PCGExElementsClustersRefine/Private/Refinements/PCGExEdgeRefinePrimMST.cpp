@@ -3,9 +3,17 @@
 
 #include "Refinements/PCGExEdgeRefinePrimMST.h"
 
+#include "Containers/PCGExUnionFind.h"
+
 #pragma region FPCGExEdgeRefinePrimMST
 
 void FPCGExEdgeRefinePrimMST::Process()
+{
+	if (Solver == EPCGExMSTSolver::Boruvka) { ProcessBoruvka(); }
+	else { ProcessPrim(); }
+}
+
+void FPCGExEdgeRefinePrimMST::ProcessPrim()
 {
 	const int32 NumNodes = Cluster->Nodes->Num();
 
@@ -64,6 +72,119 @@ void FPCGExEdgeRefinePrimMST::Process()
 	}
 }
 
+void FPCGExEdgeRefinePrimMST::ProcessBoruvka()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExEdgeRefinePrimMST::ProcessBoruvka);
+
+	const int32 NumNodes = Cluster->Nodes->Num();
+	const int32 NumEdges = Cluster->Edges->Num();
+
+	TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+
+	const PCGExClusters::FNode& RoamingSeedNode = *Heuristics->GetRoamingSeed();
+	const PCGExClusters::FNode& RoamingGoalNode = *Heuristics->GetRoamingGoal();
+
+	// Edges are scored once, up front; endpoints are resolved to node indices at the same time.
+	// Edges have no travel direction here, so direction-dependent heuristics get the cheaper of both ways.
+	TArray<double> Weights;
+	TArray<int32> EdgeStart;
+	TArray<int32> EdgeEnd;
+	Weights.SetNumUninitialized(NumEdges);
+	EdgeStart.SetNumUninitialized(NumEdges);
+	EdgeEnd.SetNumUninitialized(NumEdges);
+
+	PCGExMT::ParallelOrSequential(
+		NumEdges, [&](const int32 i)
+		{
+			const PCGExGraphs::FEdge& Edge = Edges[i];
+			const PCGExClusters::FNode& From = *Cluster->GetEdgeStart(Edge);
+			const PCGExClusters::FNode& To = *Cluster->GetEdgeEnd(Edge);
+			EdgeStart[i] = From.Index;
+			EdgeEnd[i] = To.Index;
+			Weights[i] = FMath::Min(
+				Heuristics->GetEdgeScore(From, To, Edge, RoamingSeedNode, RoamingGoalNode),
+				Heuristics->GetEdgeScore(To, From, Edge, RoamingSeedNode, RoamingGoalNode));
+		});
+
+	// Strict total order over edges, so every component agrees on the same cheapest edge and no cycle can form
+	auto IsLighter = [&](const int32 A, const int32 B)
+	{
+		return Weights[A] < Weights[B] || (Weights[A] == Weights[B] && A < B);
+	};
+
+	PCGEx::FUnionFind Components(NumNodes);
+
+	TArray<int32> Cheapest;
+	Cheapest.SetNumUninitialized(NumNodes);
+	int32* CheapestData = Cheapest.GetData();
+
+	TArray<int8> Alive; // Edges still crossing two components
+	Alive.Init(1, NumEdges);
+
+	TArray<int8> Selected;
+	Selected.Init(0, NumEdges);
+
+	auto OfferEdge = [&](const int32 Root, const int32 EdgeIndex)
+	{
+		int32 Current = FPlatformAtomics::AtomicRead_Relaxed(CheapestData + Root);
+		while (Current == -1 || IsLighter(EdgeIndex, Current))
+		{
+			const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(CheapestData + Root, EdgeIndex, Current);
+			if (Previous == Current) { return; }
+			Current = Previous;
+		}
+	};
+
+	// Each round at least halves the number of components
+	while (true)
+	{
+		PCGExMT::ParallelOrSequential(NumNodes, [&](const int32 i) { CheapestData[i] = -1; });
+
+		PCGExMT::ParallelOrSequential(
+			NumEdges, [&](const int32 i)
+			{
+				if (!Alive[i]) { return; }
+
+				const int32 A = Components.GetRoot(EdgeStart[i]);
+				const int32 B = Components.GetRoot(EdgeEnd[i]);
+
+				if (A == B)
+				{
+					Alive[i] = 0;
+					return;
+				}
+
+				OfferEdge(A, i);
+				OfferEdge(B, i);
+			});
+
+		int32 NumMerged = 0;
+		PCGExMT::ParallelOrSequential(
+			NumNodes, [&](const int32 i)
+			{
+				const int32 EdgeIndex = Cheapest[i];
+				if (EdgeIndex == -1) { return; }
+
+				// Both components may have picked the same edge; only the first union keeps it
+				if (Components.Union(EdgeStart[EdgeIndex], EdgeEnd[EdgeIndex]))
+				{
+					Selected[EdgeIndex] = 1;
+					FPlatformAtomics::InterlockedIncrement(&NumMerged);
+				}
+			});
+
+		if (!NumMerged) { break; }
+
+		Components.Flatten();
+	}
+
+	PCGExMT::ParallelOrSequential(
+		NumEdges, [&](const int32 i)
+		{
+			if (Selected[i]) { Edges[i].bValid = !bInvert; }
+		});
+}
+
 #pragma endregion
 
 #pragma region UPCGExEdgeRefinePrimMST
@@ -74,6 +195,7 @@ void UPCGExEdgeRefinePrimMST::CopySettingsFrom(const UPCGExInstancedFactory* Oth
 	if (const UPCGExEdgeRefinePrimMST* TypedOther = Cast<UPCGExEdgeRefinePrimMST>(Other))
 	{
 		bInvert = TypedOther->bInvert;
+		Solver = TypedOther->Solver;
 	}
 }
 
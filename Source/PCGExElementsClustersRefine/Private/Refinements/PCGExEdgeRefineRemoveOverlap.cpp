@@ -11,7 +11,46 @@ void FPCGExEdgeRemoveOverlap::PrepareForCluster(const TSharedPtr<PCGExClusters::
 	MinDot = bUseMinAngle ? PCGExMath::DegreesToDot(MinAngle) : 1;
 	MaxDot = bUseMaxAngle ? PCGExMath::DegreesToDot(MaxAngle) : -1;
 	ToleranceSquared = FMath::Square(Tolerance);
-	Cluster->GetBoundedEdges(true); // Let's hope it was cached ^_^
+	EdgeBVH = Cluster->GetEdgeBVH(); // Segment boxes are much tighter than the edge octree's bounding spheres
+}
+
+bool FPCGExEdgeRemoveOverlap::IsRemovedBy(const PCGExGraphs::FEdge& Edge, const double Length, const FVector& A1, const FVector& B1, const int32 OtherEdgeIndex) const
+{
+	const PCGExGraphs::FEdge& OtherEdge = *Cluster->GetEdge(OtherEdgeIndex);
+
+	if (Edge.Index == OtherEdge.Index || Edge.Start == OtherEdge.Start || Edge.Start == OtherEdge.End || Edge.End == OtherEdge.End || Edge.End == OtherEdge.Start)
+	{
+		return false;
+	}
+
+	if (bUseMinAngle || bUseMaxAngle)
+	{
+		const double Dot = FMath::Abs(FVector::DotProduct(Cluster->GetEdgeDir(Edge), Cluster->GetEdgeDir(OtherEdge)));
+		if (!(Dot >= MaxDot && Dot <= MinDot))
+		{
+			return false;
+		}
+	}
+
+	const double OtherLength = Cluster->GetDistSquared(OtherEdge);
+
+	FVector A;
+	FVector B;
+	if (Cluster->EdgeDistToEdgeSquared(&Edge, &OtherEdge, A, B) >= ToleranceSquared)
+	{
+		return false;
+	}
+
+	const FVector A2 = Cluster->GetStartPos(OtherEdge);
+	const FVector B2 = Cluster->GetEndPos(OtherEdge);
+
+	if (A == A1 || A == B1 || A == A2 || A == B2 || B == A2 || B == B2 || B == A1 || B == B1)
+	{
+		return false;
+	}
+
+	// Overlap!
+	return Keep == EPCGExEdgeOverlapPick::Longest ? OtherLength > Length : OtherLength < Length;
 }
 
 void FPCGExEdgeRemoveOverlap::ProcessEdge(PCGExGraphs::FEdge& Edge)
@@ -21,66 +60,101 @@ void FPCGExEdgeRemoveOverlap::ProcessEdge(PCGExGraphs::FEdge& Edge)
 	const FVector A1 = Cluster->GetStartPos(Edge);
 	const FVector B1 = Cluster->GetEndPos(Edge);
 
-	auto ProcessOverlap = [&](const PCGExOctree::FItem& Item)
+	(void)EdgeBVH->ForEachOverlap(
+		EdgeBVH->GetSegmentBounds(Edge.Index).ExpandBy(Tolerance), [&](const int32 OtherEdgeIndex)
+		{
+			if (!IsRemovedBy(Edge, Length, A1, B1, OtherEdgeIndex)) { return true; }
+			FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
+			return false;
+		});
+}
+
+void FPCGExEdgeRemoveOverlap::ProcessEdgeScope(const PCGExMT::FScope& Scope)
+{
+	TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+
+	FBox QueryBoxes[EdgePacketSize];
+
+	// Candidate segment bounds, SoA so the per-edge box rejection vectorizes across candidates
+	TArray<int32, TInlineAllocator<256>> Candidates;
+	TArray<double, TInlineAllocator<256>> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+
+	for (int32 PacketStart = Scope.Start; PacketStart < Scope.End; PacketStart += EdgePacketSize)
 	{
-		//if (!Edge.bValid) { return false; }
+		const int32 Count = FMath::Min(EdgePacketSize, Scope.End - PacketStart);
 
-		const PCGExGraphs::FEdge& OtherEdge = *Cluster->GetEdge(Item.Index);
+		FBox PacketBox(ForceInit);
+		double SumVolume = 0;
 
-		if (Edge.Index == OtherEdge.Index || Edge.Start == OtherEdge.Start || Edge.Start == OtherEdge.End || Edge.End == OtherEdge.End || Edge.End == OtherEdge.Start)
+		for (int32 k = 0; k < Count; k++)
 		{
-			return true;
+			QueryBoxes[k] = EdgeBVH->GetSegmentBounds(PacketStart + k).ExpandBy(Tolerance);
+			PacketBox += QueryBoxes[k];
+			SumVolume += QueryBoxes[k].GetVolume();
 		}
 
-
-		if (bUseMinAngle || bUseMaxAngle)
+		if (PacketBox.GetVolume() > SumVolume * PacketCoherenceRatio)
 		{
-			const double Dot = FMath::Abs(FVector::DotProduct(Cluster->GetEdgeDir(Edge), Cluster->GetEdgeDir(OtherEdge)));
-			if (!(Dot >= MaxDot && Dot <= MinDot))
-			{
-				return true;
-			}
+			for (int32 k = 0; k < Count; k++) { ProcessEdge(Edges[PacketStart + k]); }
+			continue;
 		}
 
-		const double OtherLength = Cluster->GetDistSquared(OtherEdge);
+		Candidates.Reset();
+		(void)EdgeBVH->ForEachOverlap(
+			PacketBox, [&](const int32 OtherEdgeIndex)
+			{
+				Candidates.Add(OtherEdgeIndex);
+				return true;
+			});
 
-		FVector A;
-		FVector B;
-		if (Cluster->EdgeDistToEdgeSquared(&Edge, &OtherEdge, A, B) >= ToleranceSquared)
-		{
-			return true;
-		}
+		const int32 NumCandidates = Candidates.Num();
+		if (NumCandidates <= 1) { continue; } // Only itself
 
-		const FVector A2 = Cluster->GetStartPos(OtherEdge);
-		const FVector B2 = Cluster->GetEndPos(OtherEdge);
+		MinX.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+		MinY.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+		MinZ.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+		MaxX.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+		MaxY.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+		MaxZ.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
 
-		if (A == A1 || A == B1 || A == A2 || A == B2 || B == A2 || B == B2 || B == A1 || B == B1)
+		for (int32 c = 0; c < NumCandidates; c++)
 		{
-			return true;
+			const FBox Box = EdgeBVH->GetSegmentBounds(Candidates[c]);
+			MinX[c] = Box.Min.X;
+			MinY[c] = Box.Min.Y;
+			MinZ[c] = Box.Min.Z;
+			MaxX[c] = Box.Max.X;
+			MaxY[c] = Box.Max.Y;
+			MaxZ[c] = Box.Max.Z;
 		}
 
-		// Overlap!
-		if (Keep == EPCGExEdgeOverlapPick::Longest)
-		{
-			if (OtherLength > Length)
-			{
-				FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
-				return false;
-			}
-		}
-		else
+		for (int32 k = 0; k < Count; k++)
 		{
-			if (OtherLength < Length)
+			PCGExGraphs::FEdge& Edge = Edges[PacketStart + k];
+
+			const double Length = Cluster->GetDistSquared(Edge);
+			const FVector A1 = Cluster->GetStartPos(Edge);
+			const FVector B1 = Cluster->GetEndPos(Edge);
+			const FBox& Query = QueryBoxes[k];
+
+			for (int32 c = 0; c < NumCandidates; c++)
 			{
-				FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
-				return false;
+				// Same inclusive overlap test as FBox::Intersect, which the per-edge path uses
+				if (MinX[c] > Query.Max.X || Query.Min.X > MaxX[c] ||
+					MinY[c] > Query.Max.Y || Query.Min.Y > MaxY[c] ||
+					MinZ[c] > Query.Max.Z || Query.Min.Z > MaxZ[c])
+				{
+					continue;
+				}
+
+				if (IsRemovedBy(Edge, Length, A1, B1, Candidates[c]))
+				{
+					FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
+					break;
+				}
 			}
 		}
-
-		return true;
-	};
-
-	(void)Cluster->GetEdgeOctree()->FindFirstElementWithBoundsTest((Cluster->BoundedEdges->GetData() + Edge.Index)->Bounds.GetBox(), ProcessOverlap);
+	}
 }
 
 #pragma endregion
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
 #include "Factories/PCGExInstancedFactory.h"
 #include "Factories/PCGExOperation.h"
 
@@ -65,6 +66,26 @@ public:
 	{
 	}
 
+	/**
+	 * Entry point for individual edge processing, called once per loop scope.
+	 * Refinements with a batched form override this and evaluate edges in packets of EdgePacketSize, sharing one
+	 * spatial query per packet. Overrides must only write to edges within the scope.
+	 */
+	virtual void ProcessEdgeScope(const PCGExMT::FScope& Scope)
+	{
+		TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+		PCGEX_SCOPE_LOOP(Index) { ProcessEdge(Edges[Index]); }
+	}
+
+	/** Edges per packet in batched refinements */
+	static constexpr int32 EdgePacketSize = 16;
+
+	/**
+	 * A packet only shares its query if its bounds are not much larger than the sum of its members'; edges that are
+	 * consecutive by index but spatially scattered are processed one by one instead.
+	 */
+	static constexpr double PacketCoherenceRatio = 8;
+
 protected:
 	TSharedPtr<PCGExClusters::FCluster> Cluster;
 	TSharedPtr<PCGExHeuristics::FHandler> Heuristics;
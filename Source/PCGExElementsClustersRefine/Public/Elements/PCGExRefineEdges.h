@@ -104,6 +104,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, EditCondition = "Mode == EPCGExRefineEdgesOutput::Clusters", EditConditionHides))
 	bool bRestoreEdgesThatConnectToValidNodes = false;
 
+	/** When no cluster of a vtx group loses a vtx or gets split by the refinement, patch the existing vtx & edges directly instead of compiling a new graph. Much cheaper on long refinement chains; falls back to a full compile otherwise. */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, EditCondition = "Mode == EPCGExRefineEdgesOutput::Clusters", EditConditionHides))
+	bool bUpdateInPlace = true;
+
 	/** Graph & Edges output properties */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, DisplayName="Cluster Output Settings", EditCondition="Mode == EPCGExRefineEdgesOutput::Clusters", EditConditionHides))
 	FPCGExGraphBuilderDetails GraphBuilderDetails;
@@ -164,6 +168,9 @@ namespace PCGExRefineEdges
 		FPCGExFilterResultDetails ResultOutputVtx = FPCGExFilterResultDetails(false, false);
 		FPCGExFilterResultDetails ResultOutputEdges = FPCGExFilterResultDetails(false, false);
 
+		bool bCanUpdateInPlace = false;
+		bool bTopologyChanged = true;
+
 		virtual TSharedPtr<PCGExClusters::FCluster> HandleCachedCluster(const TSharedRef<PCGExClusters::FCluster>& InClusterRef) override;
 		mutable FRWLock NodeLock;
 
@@ -182,7 +189,13 @@ namespace PCGExRefineEdges
 		virtual void ProcessEdges(const PCGExMT::FScope& Scope) override;
 		virtual void OnEdgesProcessingComplete() override;
 		void Sanitize();
-		void InsertEdges() const;
+		void InsertEdges();
+		void InsertGraphEdges() const;
+
+		bool CanUpdateInPlace() const { return bCanUpdateInPlace; }
+
+		/** Writes the refined cluster over its own edges, bypassing the graph builder. See UPCGExRefineEdgesSettings::bUpdateInPlace. */
+		void UpdateInPlace(const TSharedPtr<PCGExData::TBuffer<int64>>& VtxEndpointWriter, const PCGExDataId& PairId);
 		virtual void CompleteWork() override;
 
 		TSharedPtr<FPCGExEdgeRefineOperation> Refinement;
@@ -207,6 +220,7 @@ namespace PCGExRefineEdges
 
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
 		virtual void OnProcessingPreparationComplete() override;
+		virtual void CompileGraphBuilder(const bool bOutputToContext) override;
 		virtual void Write() override;
 	};
 }
@@ -16,6 +16,7 @@ class FPCGExEdgeRefineGabriel : public FPCGExEdgeRefineOperation
 public:
 	virtual void PrepareForCluster(const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics) override;
 	virtual void ProcessEdge(PCGExGraphs::FEdge& Edge) override;
+	virtual void ProcessEdgeScope(const PCGExMT::FScope& Scope) override;
 
 	int8 ExchangeValue = 0;
 	bool bInvert = false;
@@ -9,6 +9,13 @@
 #include "Utils/PCGExScoredQueue.h"
 #include "PCGExEdgeRefinePrimMST.generated.h"
 
+UENUM()
+enum class EPCGExMSTSolver : uint8
+{
+	Prim    = 0 UMETA(DisplayName = "Prim", ToolTip="Serial, grows the tree from the roaming seed. Supports every heuristic, including the ones that depend on the path travelled so far."),
+	Boruvka = 1 UMETA(DisplayName = "Boruvka", ToolTip="Parallel. Each edge is scored in both directions, keeping the cheaper one, and ignoring travel history; prefer it for large clusters scored by static heuristics."),
+};
+
 /**
  *
  */
@@ -18,6 +25,11 @@ public:
 	virtual void Process() override;
 
 	bool bInvert = false;
+	EPCGExMSTSolver Solver = EPCGExMSTSolver::Prim;
+
+protected:
+	void ProcessPrim();
+	void ProcessBoruvka();
 };
 
 /**
@@ -45,5 +57,9 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bInvert = false;
 
-	PCGEX_CREATE_REFINE_OPERATION(EdgeRefinePrimMST, { Operation->bInvert = bInvert; })
+	/** Which algorithm builds the tree. Both yield the same tree with symmetric heuristics whose scores are static and unique; equal scores are resolved by edge index with Boruvka. With direction-dependent heuristics (steepness, directional attributes...), Prim scores the direction it travels while Boruvka uses the cheaper of both directions, so trees may differ. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExMSTSolver Solver = EPCGExMSTSolver::Prim;
+
+	PCGEX_CREATE_REFINE_OPERATION(EdgeRefinePrimMST, { Operation->bInvert = bInvert; Operation->Solver = Solver; })
 };
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 
 #include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExEdgeBVH.h"
 #include "Core/PCGExEdgeRefineOperation.h"
 #include "Math/PCGExMath.h"
 #include "PCGExEdgeRefineRemoveOverlap.generated.h"
@@ -25,6 +26,7 @@ class FPCGExEdgeRemoveOverlap : public FPCGExEdgeRefineOperation
 public:
 	virtual void PrepareForCluster(const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics) override;
 	virtual void ProcessEdge(PCGExGraphs::FEdge& Edge) override;
+	virtual void ProcessEdgeScope(const PCGExMT::FScope& Scope) override;
 
 	EPCGExEdgeOverlapPick Keep = EPCGExEdgeOverlapPick::Longest;
 
@@ -38,6 +40,12 @@ public:
 	bool bUseMaxAngle = true;
 	double MaxAngle = 90;
 	double MaxDot = -1;
+
+protected:
+	TSharedPtr<PCGExClusters::FEdgeBVH> EdgeBVH;
+
+	/** Whether OtherEdgeIndex overlaps Edge in a way that gets Edge removed. Only reads cluster geometry. */
+	bool IsRemovedBy(const PCGExGraphs::FEdge& Edge, const double Length, const FVector& A1, const FVector& B1, const int32 OtherEdgeIndex) const;
 };
 
 /**
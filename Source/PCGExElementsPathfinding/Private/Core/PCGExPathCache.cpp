@@ -0,0 +1,209 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExPathCache.h"
+
+#include "PCGExH.h"
+#include "PCGExHeuristicsHandler.h"
+#include "PCGExLog.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterDiskCache.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/Utils/PCGExDataFingerprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/CityHash.h"
+#include "Search/PCGExSearchOperation.h"
+
+namespace PCGExPathfinding::PathCache
+{
+	static bool GPathCacheEnabled = false;
+	static FAutoConsoleVariableRef CVarPathCacheEnabled(
+		TEXT("pcgex.Pathfinding.PathCache"),
+		GPathCacheEnabled,
+		TEXT("Memoize pathfinding queries across executions, keyed by cluster content, heuristics and search settings."));
+
+	static int32 GPathCacheMaxSizeMB = 64;
+	static FAutoConsoleVariableRef CVarPathCacheMaxSizeMB(
+		TEXT("pcgex.Pathfinding.PathCache.MaxSizeMB"),
+		GPathCacheMaxSizeMB,
+		TEXT("Memory budget of the path cache. Least recently used buckets are evicted past this; new paths are dropped while a bucket in use exceeds it."));
+
+	static FAutoConsoleCommand CommandPathCacheStats(
+		TEXT("pcgex.Pathfinding.PathCache.Stats"),
+		TEXT("Logs path cache hit rate and memory usage."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				const FStats Stats = GetStats();
+				const int64 Total = Stats.Hits + Stats.Misses;
+				UE_LOG(LogPCGEx, Log, TEXT("PathCache : %lld hits / %lld queries (%.1f%%), %d buckets, %.2f MB, %lld evictions"),
+				       Stats.Hits, Total, Total ? 100.0 * Stats.Hits / Total : 0.0, Stats.NumBuckets, Stats.AllocatedBytes / (1024.0 * 1024.0), Stats.Evictions);
+			}));
+
+	static FAutoConsoleCommand CommandPathCacheClear(
+		TEXT("pcgex.Pathfinding.PathCache.Clear"),
+		TEXT("Drops every cached path and resets statistics."),
+		FConsoleCommandDelegate::CreateLambda([]() { Clear(); }));
+
+	class FRegistry
+	{
+	public:
+		FRWLock Lock;
+		TMap<uint64, TSharedPtr<FBucket>> Buckets;
+		uint64 Clock = 0;
+
+		std::atomic<int64> AllocatedBytes{0};
+		std::atomic<int64> Hits{0};
+		std::atomic<int64> Misses{0};
+		std::atomic<int64> Evictions{0};
+
+		static FRegistry& Get()
+		{
+			static FRegistry Registry;
+			return Registry;
+		}
+
+		static int64 GetMaxBytes() { return static_cast<int64>(FMath::Max(0, GPathCacheMaxSizeMB)) * 1024 * 1024; }
+
+		/** Evicts least recently used buckets, sparing InKeep. Expects the write lock. */
+		void TrimUnsafe(const uint64 InKeep)
+		{
+			const int64 MaxBytes = GetMaxBytes();
+			while (AllocatedBytes.load() > MaxBytes)
+			{
+				TSharedPtr<FBucket> Oldest;
+				for (const TPair<uint64, TSharedPtr<FBucket>>& Pair : Buckets)
+				{
+					if (Pair.Key == InKeep) { continue; }
+					if (!Oldest || Pair.Value->LastUsed < Oldest->LastUsed) { Oldest = Pair.Value; }
+				}
+
+				if (!Oldest) { return; }
+
+				{
+					FWriteScopeLock BucketLock(Oldest->Lock);
+					Oldest->bEvicted = true;
+					AllocatedBytes -= Oldest->AllocatedBytes;
+					Oldest->Paths.Empty();
+					Oldest->AllocatedBytes = 0;
+				}
+
+				Buckets.Remove(Oldest->Key);
+				++Evictions;
+			}
+		}
+	};
+
+	bool FBucket::Find(const int32 InSeedNode, const int32 InGoalNode, TArray<int32>& OutPathNodes) const
+	{
+		FRegistry& Registry = FRegistry::Get();
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const TArray<int32>* Path = Paths.Find(PCGEx::H64(InSeedNode, InGoalNode)))
+			{
+				OutPathNodes = *Path;
+				++Registry.Hits;
+				return true;
+			}
+		}
+
+		++Registry.Misses;
+		return false;
+	}
+
+	void FBucket::Add(const int32 InSeedNode, const int32 InGoalNode, TConstArrayView<int32> InPathNodes)
+	{
+		FRegistry& Registry = FRegistry::Get();
+
+		const int64 Bytes = sizeof(uint64) + sizeof(TArray<int32>) + InPathNodes.Num() * sizeof(int32);
+		if (Registry.AllocatedBytes.load() + Bytes > FRegistry::GetMaxBytes()) { return; }
+
+		FWriteScopeLock WriteLock(Lock);
+		if (bEvicted) { return; }
+
+		const uint64 PairKey = PCGEx::H64(InSeedNode, InGoalNode);
+		if (Paths.Contains(PairKey)) { return; }
+		Paths.Add(PairKey, TArray<int32>(InPathNodes));
+
+		AllocatedBytes += Bytes;
+		Registry.AllocatedBytes += Bytes;
+	}
+
+	bool IsEnabled()
+	{
+		return GPathCacheEnabled;
+	}
+
+	TSharedPtr<FBucket> Acquire(const TSharedRef<PCGExClusters::FCluster>& InCluster, const UPCGExSearchInstancedFactory* InSearchFactory, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics)
+	{
+		if (!GPathCacheEnabled || !InSearchFactory || !InHeuristics || InHeuristics->HasAnyFeedback()) { return nullptr; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCache::Acquire);
+
+		const TSharedPtr<PCGExData::FPointIO> VtxIO = InCluster->VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> EdgesIO = InCluster->EdgesIO.Pin();
+		if (!VtxIO || !EdgesIO) { return nullptr; }
+
+		const uint64 TopologyKey = PCGExClusters::DiskCache::ComputeKey(VtxIO.ToSharedRef(), EdgesIO.ToSharedRef());
+		if (!TopologyKey) { return nullptr; }
+
+		// Heuristics may read any property or attribute; tags are irrelevant to scores
+		PCGExFingerprint::FOptions Options;
+		Options.Tolerance = UE_DOUBLE_KINDA_SMALL_NUMBER;
+		Options.bIncludeTags = false;
+		Options.bIncludeSeed = true;
+
+		uint64 Key = TopologyKey;
+		Key = CityHash128to64(Uint128_64(Key, PCGExFingerprint::Compute(*VtxIO, Options).Hash));
+		Key = CityHash128to64(Uint128_64(Key, PCGExFingerprint::Compute(*EdgesIO, Options).Hash));
+		Key = CityHash128to64(Uint128_64(Key, InHeuristics->ConfigHash));
+		Key = CityHash128to64(Uint128_64(Key, PCGExFingerprint::ComputeSettings(InSearchFactory, UPCGExSearchInstancedFactory::StaticClass())));
+
+		FRegistry& Registry = FRegistry::Get();
+		FWriteScopeLock WriteLock(Registry.Lock);
+
+		TSharedPtr<FBucket>& Bucket = Registry.Buckets.FindOrAdd(Key);
+		if (!Bucket) { Bucket = MakeShared<FBucket>(Key); }
+		Bucket->LastUsed = ++Registry.Clock;
+
+		TSharedPtr<FBucket> Result = Bucket;
+		Registry.TrimUnsafe(Key);
+
+		return Result;
+	}
+
+	FStats GetStats()
+	{
+		FRegistry& Registry = FRegistry::Get();
+		FReadScopeLock ReadLock(Registry.Lock);
+
+		FStats Stats;
+		Stats.Hits = Registry.Hits.load();
+		Stats.Misses = Registry.Misses.load();
+		Stats.Evictions = Registry.Evictions.load();
+		Stats.AllocatedBytes = Registry.AllocatedBytes.load();
+		Stats.NumBuckets = Registry.Buckets.Num();
+		return Stats;
+	}
+
+	void Clear()
+	{
+		FRegistry& Registry = FRegistry::Get();
+		FWriteScopeLock WriteLock(Registry.Lock);
+
+		for (const TPair<uint64, TSharedPtr<FBucket>>& Pair : Registry.Buckets)
+		{
+			FWriteScopeLock BucketLock(Pair.Value->Lock);
+			Pair.Value->bEvicted = true;
+			Pair.Value->Paths.Empty();
+			Pair.Value->AllocatedBytes = 0;
+		}
+
+		Registry.Buckets.Empty();
+		Registry.AllocatedBytes = 0;
+		Registry.Hits = 0;
+		Registry.Misses = 0;
+		Registry.Evictions = 0;
+	}
+}
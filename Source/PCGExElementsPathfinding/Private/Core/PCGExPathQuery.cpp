@@ -5,6 +5,7 @@
 
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
+#include "Core/PCGExPathCache.h"
 #include "Data/PCGExData.h"
 #include "Search/PCGExSearchOperation.h"
 
@@ -103,15 +104,28 @@ namespace PCGExPathfinding
 			return;
 		}
 
-		PCGEX_SHARED_THIS_DECL
+		const TSharedPtr<PathCache::FBucket>& PathCache = SearchOperation->PathCache;
 
-		if (SearchOperation->ResolveQuery(ThisPtr, Allocations, HeuristicsHandler, LocalFeedback))
+		if (PathCache && PathCache->Find(Seed.Node->Index, Goal.Node->Index, PathNodes))
 		{
-			SetResolution(HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+			RestorePathEdges();
+			Resolution = HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail;
 		}
 		else
 		{
-			SetResolution(EPathfindingResolution::Fail);
+			PCGEX_SHARED_THIS_DECL
+
+			if (SearchOperation->ResolveQuery(ThisPtr, Allocations, HeuristicsHandler, LocalFeedback))
+			{
+				SetResolution(HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+			}
+			else
+			{
+				SetResolution(EPathfindingResolution::Fail);
+			}
+
+			// Failures are cached as empty paths
+			if (PathCache) { PathCache->Add(Seed.Node->Index, Goal.Node->Index, IsQuerySuccessful() ? PathNodes : TArray<int32>()); }
 		}
 
 		if (Resolution == EPathfindingResolution::Fail)
@@ -160,6 +174,23 @@ namespace PCGExPathfinding
 		}
 	}
 
+	void FPathQuery::RestorePathEdges()
+	{
+		PathEdges.Reset(FMath::Max(0, PathNodes.Num() - 1));
+
+		const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+		for (int i = 1; i < PathNodes.Num(); i++)
+		{
+			const int32 To = PathNodes[i];
+			for (const PCGExGraphs::FLink Lk : NodesRef[PathNodes[i - 1]].Links)
+			{
+				if (Lk.Node != To) { continue; }
+				PathEdges.Add(Lk.Edge);
+				break;
+			}
+		}
+	}
+
 	void FPathQuery::AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart, const int32 TruncateEnd) const
 	{
 		const int32 Count = PathNodes.Num() - TruncateEnd;
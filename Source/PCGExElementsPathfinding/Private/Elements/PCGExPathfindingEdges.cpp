@@ -10,6 +10,7 @@
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
+#include "Core/PCGExPathCache.h"
 #include "Core/PCGExPathQuery.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -344,6 +345,7 @@ namespace PCGExPathfindingEdges
 
 		SearchOperation = Context->SearchAlgorithm->CreateOperation(); // Create a local copy
 		SearchOperation->PrepareForCluster(Cluster.Get());
+		SearchOperation->PathCache = PCGExPathfinding::PathCache::Acquire(Cluster.ToSharedRef(), Context->SearchAlgorithm, HeuristicsHandler);
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange)
@@ -360,6 +362,28 @@ namespace PCGExPathfindingEdges
 			HeuristicsHandler->BakeStaticEdgeScores();
 		}
 
+		// Many seeds converging on few goals re-evaluate the same goal-bound global scores from every query;
+		// tabulate them once per distinct goal node instead.
+		if (HeuristicsHandler->CanBakeGoalScores())
+		{
+			TSet<int32> UniqueGoals;
+			for (const uint64 Pair : Context->SeedGoalPairs) { UniqueGoals.Add(PCGEx::H64B(Pair)); }
+
+			if (UniqueGoals.Num() * 2 <= NumQueries)
+			{
+				TArray<int32> GoalNodes;
+				GoalNodes.Reserve(UniqueGoals.Num());
+
+				for (const int32 GoalIndex : UniqueGoals)
+				{
+					PCGExPathfinding::FNodePick GoalPick(Context->GoalsDataFacade->Source->GetInPoint(GoalIndex));
+					if (GoalPick.ResolveNode(Cluster.ToSharedRef(), Settings->GoalPicking)) { GoalNodes.AddUnique(GoalPick.Node->Index); }
+				}
+
+				HeuristicsHandler->BakeGoalScores(GoalNodes);
+			}
+		}
+
 		PCGExArrayHelpers::InitArray(Queries, NumQueries);
 
 		if (bVisited)
@@ -83,6 +83,15 @@ namespace PCGExPathfindingGrowPaths
 				continue;
 			}
 
+			if (!Processor->NodeClaims.IsEmpty())
+			{
+				const int32 Claim = Processor->NodeClaims[Lk.Node];
+				if (Claim != -1 && Claim != GrowthIndex)
+				{
+					continue;
+				}
+			}
+
 			/*
 			// TODO : Implement
 			if (Settings->VisitedStopThreshold > 0 && Context->GlobalExtraWeights &&
@@ -481,7 +490,11 @@ namespace PCGExPathfindingGrowPaths
 
 	void FProcessor::Grow()
 	{
-		if (Settings->GrowthMode == EPCGExGrowthIterationMode::Parallel)
+		if (Settings->GrowthMode == EPCGExGrowthIterationMode::Rounds)
+		{
+			GrowInRounds();
+		}
+		else if (Settings->GrowthMode == EPCGExGrowthIterationMode::Parallel)
 		{
 			for (const TSharedPtr<FGrowth>& Growth : QueuedGrowths)
 			{
@@ -512,6 +525,95 @@ namespace PCGExPathfindingGrowPaths
 		}
 	}
 
+	void FProcessor::GrowInRounds()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingGrowPaths::GrowInRounds);
+
+		const int32 NumGrowths = QueuedGrowths.Num();
+		const int32 NumNodes = Cluster->Nodes->Num();
+
+		TArray<int32> Active;
+		Active.SetNumUninitialized(NumGrowths);
+		for (int32 i = 0; i < NumGrowths; i++)
+		{
+			Active[i] = i;
+			QueuedGrowths[i]->GrowthIndex = i;
+		}
+
+		// Per node, lowest growth index that wants it this round
+		TArray<int32> Contenders;
+		int32* ContendersData = nullptr;
+
+		if (Settings->bClaimNodes)
+		{
+			NodeClaims.Init(-1, NumNodes);
+			Contenders.Init(MAX_int32, NumNodes);
+			ContendersData = Contenders.GetData();
+
+			// First steps were taken when the growths were created; earliest growth keeps contested ones
+			for (int32 i = 0; i < NumGrowths; i++)
+			{
+				int32& Claim = NodeClaims[QueuedGrowths[i]->LastGrowthIndex];
+				if (Claim == -1) { Claim = i; }
+			}
+		}
+
+		while (!Active.IsEmpty())
+		{
+			// Evaluation only reads shared state (claims, heuristic feedback), both frozen until the commit below
+			PCGExMT::ParallelOrSequential(
+				Active.Num(), [&](const int32 i)
+				{
+					FGrowth& Growth = *QueuedGrowths[Active[i]];
+					if (Growth.FindNextGrowthNodeIndex() == -1 || !ContendersData) { return; }
+
+					int32* Contender = ContendersData + Growth.NextGrowthIndex;
+					int32 Current = FPlatformAtomics::AtomicRead_Relaxed(Contender);
+					while (Growth.GrowthIndex < Current)
+					{
+						const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(Contender, Growth.GrowthIndex, Current);
+						if (Previous == Current) { break; }
+						Current = Previous;
+					}
+				}, 32);
+
+			// Commit in growth order so that feedback is applied deterministically, and compact finished growths away
+			int32 NumActive = 0;
+			for (int32 i = 0; i < Active.Num(); i++)
+			{
+				const int32 Index = Active[i];
+				FGrowth& Growth = *QueuedGrowths[Index];
+
+				if (Growth.NextGrowthIndex == -1) { continue; }
+
+				if (ContendersData)
+				{
+					int32& Contender = Contenders[Growth.NextGrowthIndex];
+					if (Contender != Index)
+					{
+						// Lost the node to an earlier growth; pick again next round
+						Active[NumActive++] = Index;
+						continue;
+					}
+
+					Contender = MAX_int32;
+					if (!Growth.Grow()) { continue; }
+					NodeClaims[Growth.LastGrowthIndex] = Index;
+				}
+				else if (!Growth.Grow())
+				{
+					continue;
+				}
+
+				Active[NumActive++] = Index;
+			}
+
+			Active.SetNum(NumActive, EAllowShrinking::No);
+		}
+
+		QueuedGrowths.Empty();
+	}
+
 	void FGrowTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
 	{
 		Processor->Grow();
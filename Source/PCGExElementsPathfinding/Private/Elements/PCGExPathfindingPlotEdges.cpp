@@ -10,6 +10,7 @@
 #include "Clusters/PCGExClusterDataLibrary.h"
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
+#include "Core/PCGExPathCache.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExPlotQuery.h"
 #include "Data/PCGExData.h"
@@ -476,6 +477,7 @@ namespace PCGExPathfindingPlotEdges
 
 		SearchOperation = Context->SearchAlgorithm->CreateOperation(); // Create a local copy
 		SearchOperation->PrepareForCluster(Cluster.Get());
+		SearchOperation->PathCache = PCGExPathfinding::PathCache::Acquire(Cluster.ToSharedRef(), Context->SearchAlgorithm, HeuristicsHandler);
 		const int32 NumPlots = ValidPlots.Num();
 		PCGExArrayHelpers::InitArray(Queries, NumPlots);
 
@@ -0,0 +1,77 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPCGExSearchInstancedFactory;
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExHeuristics
+{
+	class FHandler;
+}
+
+/**
+ * In-memory memoization of path queries, shared across executions.
+ * Results are grouped in buckets keyed by cluster content (topology, point properties and attributes), heuristics
+ * configuration and search configuration; any change to one of these yields a new bucket, and stale ones age out.
+ * Queries using heuristic feedback are history-dependent and never cached.
+ * Disabled by default, see pcgex.Pathfinding.PathCache.*
+ */
+namespace PCGExPathfinding::PathCache
+{
+	struct FStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Evictions = 0;
+		int64 AllocatedBytes = 0;
+		int32 NumBuckets = 0;
+	};
+
+	class PCGEXELEMENTSPATHFINDING_API FBucket : public TSharedFromThis<FBucket>
+	{
+		friend class FRegistry;
+
+	public:
+		explicit FBucket(const uint64 InKey)
+			: Key(InKey)
+		{
+		}
+
+		const uint64 Key;
+
+		/**
+		 * Node path from seed to goal, empty for a cached failure. Returns false on miss.
+		 * Thread-safe.
+		 */
+		bool Find(const int32 InSeedNode, const int32 InGoalNode, TArray<int32>& OutPathNodes) const;
+
+		/** No-op once the bucket is evicted or the cache is full. Thread-safe. */
+		void Add(const int32 InSeedNode, const int32 InGoalNode, TConstArrayView<int32> InPathNodes);
+
+	protected:
+		mutable FRWLock Lock;
+		TMap<uint64, TArray<int32>> Paths;
+		int64 AllocatedBytes = 0;
+		uint64 LastUsed = 0;
+		bool bEvicted = false;
+	};
+
+	PCGEXELEMENTSPATHFINDING_API bool IsEnabled();
+
+	/**
+	 * Bucket matching the cluster content and the heuristics/search configuration, created if needed.
+	 * Null if the cache is disabled or the heuristics use feedback.
+	 */
+	PCGEXELEMENTSPATHFINDING_API TSharedPtr<FBucket> Acquire(const TSharedRef<PCGExClusters::FCluster>& InCluster, const UPCGExSearchInstancedFactory* InSearchFactory, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics);
+
+	PCGEXELEMENTSPATHFINDING_API FStats GetStats();
+	PCGEXELEMENTSPATHFINDING_API void Clear();
+}
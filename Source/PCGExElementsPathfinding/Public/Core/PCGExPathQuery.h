@@ -83,6 +83,9 @@ namespace PCGExPathfinding
 			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler,
 			const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback);
 
+		/** Rebuilds PathEdges from consecutive PathNodes, for paths restored from the path cache. */
+		void RestorePathEdges();
+
 		void AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart = 0, const int32 TruncateEnd = 0) const;
 
 		void AppendEdgePoints(TArray<int32>& OutPoints) const;
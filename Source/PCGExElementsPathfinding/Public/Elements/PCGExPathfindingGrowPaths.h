@@ -24,6 +24,7 @@ enum class EPCGExGrowthIterationMode : uint8
 {
 	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Does one growth iteration on each seed until none remain"),
 	Sequence = 1 UMETA(DisplayName = "Sequence", ToolTip="Grow a seed to its end, then move to the next seed"),
+	Rounds   = 2 UMETA(DisplayName = "Rounds", ToolTip="Every active seed picks its next step in parallel, then all steps are committed at once. Heuristic feedback is applied between rounds."),
 };
 
 UENUM()
@@ -54,6 +55,7 @@ namespace PCGExPathfindingGrowPaths
 		TSharedPtr<PCGEx::FHashLookup> TravelStack;
 
 		int32 SeedPointIndex = -1;
+		int32 GrowthIndex = -1; // Position in the processor's queue, used as node claim id
 		int32 MaxIterations = 0;
 		int32 SoftMaxIterations = 0;
 		int32 Iteration = 0;
@@ -197,6 +199,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="GrowthMaxDistance == EPCGExGrowthValueSource::Constant", EditConditionHides))
 	double GrowthMaxDistanceConstant = 500;
 
+	/** Rounds mode only. A node can only be grown into by a single path; when several paths want the same node in the same round, the one from the earliest seed wins and the others pick again next round. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="GrowthMode == EPCGExGrowthIterationMode::Rounds", EditConditionHides))
+	bool bClaimNodes = false;
+
 	/** Enable growth stop points that terminate paths when reached. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Limits", meta = (PCG_Overridable))
 	bool bUseGrowthStop = false;
@@ -286,6 +292,8 @@ namespace PCGExPathfindingGrowPaths
 		TSharedPtr<PCGExData::TBuffer<bool>> GrowthStop;
 		TSharedPtr<PCGExData::TBuffer<bool>> NoGrowth;
 
+		TArray<int32> NodeClaims; // Per node, index of the growth that claimed it; only allocated when claiming
+
 	public:
 		TArray<TSharedPtr<FGrowth>> Growths;
 		TArray<TSharedPtr<FGrowth>> QueuedGrowths;
@@ -298,6 +306,9 @@ namespace PCGExPathfindingGrowPaths
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void CompleteWork() override;
 		void Grow();
+
+	protected:
+		void GrowInRounds();
 	};
 
 	class FGrowTask final : public PCGExMT::FTask
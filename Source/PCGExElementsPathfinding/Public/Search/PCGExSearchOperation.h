@@ -23,6 +23,11 @@ namespace PCGExPathfinding
 	class FSearchAllocations;
 	class FPathQuery;
 	struct FExtraWeights;
+
+	namespace PathCache
+	{
+		class FBucket;
+	}
 }
 
 class FPCGExHeuristicOperation;
@@ -38,6 +43,9 @@ public:
 	bool bEarlyExit = true;
 	PCGExClusters::FCluster* Cluster = nullptr;
 
+	/** Cross-execution results for this cluster & configuration, if caching applies. See PCGExPathCache.h */
+	TSharedPtr<PCGExPathfinding::PathCache::FBucket> PathCache;
+
 	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster);
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
@@ -69,6 +69,24 @@ void FPCGExProbeOperation::ProcessAll(TSet<uint64>& OutEdges) const
 {
 }
 
+bool FPCGExProbeOperation::SupportsScopedProcessing() const
+{
+	return false;
+}
+
+int32 FPCGExProbeOperation::GetNumScopedPasses() const
+{
+	return 1;
+}
+
+void FPCGExProbeOperation::PrepareScopedPass(const int32 Pass, const int32 NumPoints)
+{
+}
+
+void FPCGExProbeOperation::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
+{
+}
+
 double FPCGExProbeOperation::GetSearchRadius(const int32 Index) const
 {
 	return FMath::Square(SearchRadius->Read(Index) + SearchRadiusOffset);
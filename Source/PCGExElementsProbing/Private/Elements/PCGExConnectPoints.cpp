@@ -3,6 +3,7 @@
 
 #include "Elements/PCGExConnectPoints.h"
 
+#include "Algo/Unique.h"
 #include "Containers/PCGExScopedContainers.h"
 #include "Core/PCGExPointFilter.h"
 #include "Core/PCGExProbeFactoryProvider.h"
@@ -15,6 +16,7 @@
 #include "Graphs/PCGExGraph.h"
 #include "Graphs/PCGExGraphBuilder.h"
 #include "Helpers/PCGExArrayHelpers.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 #define LOCTEXT_NAMESPACE "PCGExConnectPointsElement"
 #define PCGEX_NAMESPACE BuildCustomGraph
@@ -165,7 +167,14 @@ namespace PCGExConnectPoints
 
 			if (NewOperation->IsGlobalProbe())
 			{
-				GlobalOperations.Add(NewOperation.Get());
+				if (NewOperation->SupportsScopedProcessing())
+				{
+					ScopedGlobalOperations.Add(NewOperation.Get());
+				}
+				else
+				{
+					GlobalOperations.Add(NewOperation.Get());
+				}
 				continue;
 			}
 
@@ -198,6 +207,7 @@ namespace PCGExConnectPoints
 		NumSharedOps = SharedOperations.Num();
 		NumDirectOps = DirectOperations.Num();
 		NumGlobalOps = GlobalOperations.Num();
+		NumScopedGlobalOps = ScopedGlobalOperations.Num();
 
 		if (!RadiusSources.IsEmpty())
 		{
@@ -206,7 +216,7 @@ namespace PCGExConnectPoints
 
 		bOnlyGlobalOps = RadiusSources.IsEmpty() && DirectOperations.IsEmpty();
 
-		if (bOnlyGlobalOps && GlobalOperations.IsEmpty())
+		if (bOnlyGlobalOps && GlobalOperations.IsEmpty() && ScopedGlobalOperations.IsEmpty())
 		{
 			return false;
 		}
@@ -329,7 +339,7 @@ namespace PCGExConnectPoints
 		GeneratorsFilter.Reset();
 		ConnectableFilter.Reset();
 
-		NumCompletions = GlobalOperations.IsEmpty() ? 0 : 1;
+		NumCompletions = (GlobalOperations.IsEmpty() ? 0 : 1) + NumScopedGlobalOps;
 		if (!bOnlyGlobalOps)
 		{
 			NumCompletions++;
@@ -361,6 +371,62 @@ namespace PCGExConnectPoints
 
 			GlobalOpsTasks->StartSimpleCallbacks();
 		}
+
+		if (NumScopedGlobalOps > 0)
+		{
+			ScopedGlobalPassEdges.SetNum(NumScopedGlobalOps);
+			ScopedGlobalEdges.SetNum(NumScopedGlobalOps);
+			for (int32 i = 0; i < NumScopedGlobalOps; i++)
+			{
+				StartScopedGlobalPass(i, 0);
+			}
+		}
+	}
+
+	void FProcessor::StartScopedGlobalPass(const int32 OpIndex, const int32 Pass)
+	{
+		const int32 NumPoints = PointDataFacade->GetNum();
+		ScopedGlobalOperations[OpIndex]->PrepareScopedPass(Pass, NumPoints);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ScopedGlobalPass)
+
+		ScopedGlobalPass->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, OpIndex, Pass]()
+		{
+			PCGEX_ASYNC_THIS
+
+			// Collapsed in scope order, so the result doesn't depend on scheduling
+			TArray<uint64>& OpEdges = This->ScopedGlobalEdges[OpIndex];
+			if (This->ScopedGlobalPassEdges[OpIndex])
+			{
+				This->ScopedGlobalPassEdges[OpIndex]->Collapse(OpEdges);
+				This->ScopedGlobalPassEdges[OpIndex].Reset();
+			}
+
+			if (Pass + 1 < This->ScopedGlobalOperations[OpIndex]->GetNumScopedPasses())
+			{
+				This->StartScopedGlobalPass(OpIndex, Pass + 1);
+				return;
+			}
+
+			PCGExSortingHelpers::RadixSort(OpEdges);
+			OpEdges.SetNum(Algo::Unique(OpEdges));
+
+			This->AdvanceCompletion();
+		};
+
+		ScopedGlobalPass->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE, OpIndex](const TArray<PCGExMT::FScope>& Loops)
+		{
+			PCGEX_ASYNC_THIS
+			This->ScopedGlobalPassEdges[OpIndex] = MakeShared<PCGExMT::TScopedArray<uint64>>(Loops);
+		};
+
+		ScopedGlobalPass->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE, OpIndex, Pass](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->ScopedGlobalOperations[OpIndex]->ProcessScope(Pass, Scope, This->ScopedGlobalPassEdges[OpIndex]->Get_Ref(Scope));
+		};
+
+		ScopedGlobalPass->StartSubLoops(NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 	}
 
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
@@ -512,6 +578,24 @@ namespace PCGExConnectPoints
 		}
 
 		GraphBuilder->Graph->InsertEdges_Unsafe(UniqueEdges, -1);
+
+		if (NumScopedGlobalOps > 0)
+		{
+			TArray<uint64> GlobalEdges = MoveTemp(ScopedGlobalEdges[0]);
+			if (NumScopedGlobalOps > 1)
+			{
+				for (int32 i = 1; i < NumScopedGlobalOps; i++)
+				{
+					GlobalEdges.Append(ScopedGlobalEdges[i]);
+				}
+
+				PCGExSortingHelpers::RadixSort(GlobalEdges);
+				GlobalEdges.SetNum(Algo::Unique(GlobalEdges));
+			}
+
+			ScopedGlobalEdges.Empty();
+			GraphBuilder->Graph->InsertEdges(GlobalEdges, -1);
+		}
 		GraphBuilder->CompileAsync(TaskManager, true);
 	}
 
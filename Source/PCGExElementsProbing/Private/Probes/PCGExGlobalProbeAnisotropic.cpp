@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeAnisotropic.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(GlobalAnisotropic, {}, {})
@@ -46,7 +47,12 @@ double FPCGExProbeGlobalAnisotropic::ComputeGlobalAnisotropicDistSq(const FVecto
 	return Transformed.SizeSquared();
 }
 
-void FPCGExProbeGlobalAnisotropic::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeGlobalAnisotropic::SupportsScopedProcessing() const
+{
+	return true;
+}
+
+void FPCGExProbeGlobalAnisotropic::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -64,7 +70,7 @@ void FPCGExProbeGlobalAnisotropic::ProcessAll(TSet<uint64>& OutEdges) const
 	// Determine max isotropic search radius (conservative estimate)
 	const double MaxScale = FMath::Max3(Config.PrimaryScale, Config.SecondaryScale, Config.TertiaryScale);
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i])
 		{
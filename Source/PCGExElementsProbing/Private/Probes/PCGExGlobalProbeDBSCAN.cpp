@@ -2,10 +2,25 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeDBSCAN.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
+#include "Details/PCGExSettingsDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 PCGEX_CREATE_PROBE_FACTORY(DBSCAN, {}, {})
 
+namespace PCGExProbeDBSCAN
+{
+	FORCEINLINE uint64 CellKey(const int64 X, const int64 Y, const int64 Z)
+	{
+		uint64 Hash = 14695981039346656037ULL;
+		Hash = (Hash ^ X) * 1099511628211ULL;
+		Hash = (Hash ^ Y) * 1099511628211ULL;
+		Hash = (Hash ^ Z) * 1099511628211ULL;
+		return Hash;
+	}
+}
+
 bool FPCGExProbeDBSCAN::IsGlobalProbe() const
 {
 	return true;
@@ -13,7 +28,7 @@ bool FPCGExProbeDBSCAN::IsGlobalProbe() const
 
 bool FPCGExProbeDBSCAN::WantsOctree() const
 {
-	return true;
+	return false;
 }
 
 bool FPCGExProbeDBSCAN::Prepare(FPCGExContext* InContext)
@@ -21,60 +36,164 @@ bool FPCGExProbeDBSCAN::Prepare(FPCGExContext* InContext)
 	return FPCGExProbeOperation::Prepare(InContext);
 }
 
-void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeDBSCAN::SupportsScopedProcessing() const
 {
-	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2)
+	return true;
+}
+
+int32 FPCGExProbeDBSCAN::GetNumScopedPasses() const
+{
+	// Binning, core points, edges
+	return 3;
+}
+
+void FPCGExProbeDBSCAN::PrepareScopedPass(const int32 Pass, const int32 NumPoints)
+{
+	if (Pass == 0)
 	{
-		return;
-	}
+		IsCore.Init(0, NumPoints);
+		CellEntries.Reset();
+		CellStarts.Reset();
 
-	const TArray<int8>& CanGenerateRef = *CanGenerate;
-	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
+		if (NumPoints < 2)
+		{
+			return;
+		}
 
-	// First pass: identify core points and their neighbors
-	TArray<TArray<int32>> Neighborhoods;
-	TArray<bool> IsCore;
-	Neighborhoods.SetNum(NumPoints);
-	IsCore.Init(false, NumPoints);
+		CellEntries.SetNumUninitialized(NumPoints);
 
-	for (int32 i = 0; i < NumPoints; ++i)
+		double MaxRadiusSq = GetSearchRadius(0);
+		if (!SearchRadius->IsConstant())
+		{
+			for (int32 i = 1; i < NumPoints; i++)
+			{
+				MaxRadiusSq = FMath::Max(MaxRadiusSq, GetSearchRadius(i));
+			}
+		}
+
+		InvCellSize = 1.0 / FMath::Max(FMath::Sqrt(MaxRadiusSq), UE_KINDA_SMALL_NUMBER);
+	}
+	else if (Pass == 1)
 	{
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i])
+		// Points that can neither generate nor accept connections don't count toward density.
+		// Generator-only points do, and like any neighbor can receive edges from core points.
+		const TArray<int8>& CanGenerateRef = *CanGenerate;
+		const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
+		CellEntries.RemoveAll([&](const PCGEx::FIndexKey& Entry) { return !CanGenerateRef[Entry.Index] && !AcceptConnectionsRef[Entry.Index]; });
+
+		// Stable, points within a cell remain in index order
+		PCGExSortingHelpers::RadixSort(CellEntries);
+
+		for (int32 i = 0; i < CellEntries.Num(); i++)
 		{
-			continue;
+			if (i == 0 || CellEntries[i].Key != CellEntries[i - 1].Key)
+			{
+				CellStarts.Add(CellEntries[i].Key, i);
+			}
 		}
+	}
+}
+
+template <typename FUNC>
+void FPCGExProbeDBSCAN::ForEachNeighbor(const int32 Index, FUNC&& Func) const
+{
+	const TArray<FVector>& Positions = *WorkingPositions;
+	const FVector& Pos = Positions[Index];
+	const double MaxDistSq = GetSearchRadius(Index);
+
+	const int64 CX = FMath::FloorToInt64(Pos.X * InvCellSize);
+	const int64 CY = FMath::FloorToInt64(Pos.Y * InvCellSize);
+	const int64 CZ = FMath::FloorToInt64(Pos.Z * InvCellSize);
 
-		const FVector& Pos = Positions[i];
-		const double MaxDistSq = GetSearchRadius(i);
-		const double MaxDist = FMath::Sqrt(MaxDistSq);
+	// Distinct cells may share a key; make sure each bucket is only visited once
+	TArray<uint64, TInlineAllocator<27>> VisitedCells;
 
-		Octree->FindElementsWithBoundsTest(
-			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+	for (int64 X = CX - 1; X <= CX + 1; X++)
+	{
+		for (int64 Y = CY - 1; Y <= CY + 1; Y++)
+		{
+			for (int64 Z = CZ - 1; Z <= CZ + 1; Z++)
 			{
-				const int32 j = Other.Index;
-				if (i == j)
+				const uint64 Key = PCGExProbeDBSCAN::CellKey(X, Y, Z);
+				if (VisitedCells.Contains(Key))
 				{
-					return;
+					continue;
 				}
-				if (!CanGenerateRef[j] && !AcceptConnectionsRef[j])
+
+				VisitedCells.Add(Key);
+
+				const int32* Start = CellStarts.Find(Key);
+				if (!Start)
 				{
-					return;
+					continue;
 				}
 
-				if (FVector::DistSquared(Pos, Positions[j]) <= MaxDistSq)
+				for (int32 e = *Start; e < CellEntries.Num() && CellEntries[e].Key == Key; e++)
 				{
-					Neighborhoods[i].Add(j);
+					const int32 j = CellEntries[e].Index;
+					if (j == Index || FVector::DistSquared(Pos, Positions[j]) > MaxDistSq)
+					{
+						continue;
+					}
+
+					if (!Func(j))
+					{
+						return;
+					}
 				}
-			});
+			}
+		}
+	}
+}
+
+void FPCGExProbeDBSCAN::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
+{
+	const TArray<FVector>& Positions = *WorkingPositions;
+	const int32 NumPoints = Positions.Num();
+	if (NumPoints < 2)
+	{
+		return;
+	}
+
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
+
+	if (Pass == 0)
+	{
+		// First pass: bin points into cells
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const FVector& Pos = Positions[i];
+			CellEntries[i] = PCGEx::FIndexKey(
+				i, PCGExProbeDBSCAN::CellKey(
+					FMath::FloorToInt64(Pos.X * InvCellSize),
+					FMath::FloorToInt64(Pos.Y * InvCellSize),
+					FMath::FloorToInt64(Pos.Z * InvCellSize)));
+		}
+
+		return;
+	}
+
+	if (Pass == 1)
+	{
+		// Second pass: identify core points, only counting neighbors up to MinPoints
+		PCGEX_SCOPE_LOOP(i)
+		{
+			if (!CanGenerateRef[i] && !AcceptConnectionsRef[i])
+			{
+				continue;
+			}
+
+			int32 Count = 0;
+			ForEachNeighbor(i, [&](const int32 j) { return ++Count < Config.MinPoints; });
+			IsCore[i] = Count >= Config.MinPoints;
+		}
 
-		IsCore[i] = Neighborhoods[i].Num() >= Config.MinPoints;
+		return;
 	}
 
-	// Second pass: create edges
-	for (int32 i = 0; i < NumPoints; ++i)
+	// Third pass: create edges
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i])
 		{
@@ -84,15 +203,15 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 		if (IsCore[i])
 		{
 			// Core point: connect to neighbors
-			for (const int32 j : Neighborhoods[i])
-			{
-				if (Config.bCoreToCorOnly && !IsCore[j])
+			ForEachNeighbor(
+				i, [&](const int32 j)
 				{
-					continue;
-				}
-
-				OutEdges.Add(PCGEx::H64U(i, j));
-			}
+					if (!Config.bCoreToCorOnly || IsCore[j])
+					{
+						OutEdges.Add(PCGEx::H64U(i, j));
+					}
+					return true;
+				});
 		}
 		else if (!Config.bCoreToCorOnly)
 		{
@@ -103,18 +222,20 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 				double BestDist = TNumericLimits<double>::Max();
 				int32 BestCore = INDEX_NONE;
 
-				for (const int32 j : Neighborhoods[i])
-				{
-					if (IsCore[j])
+				ForEachNeighbor(
+					i, [&](const int32 j)
 					{
-						const double Dist = FVector::DistSquared(Positions[i], Positions[j]);
-						if (Dist < BestDist)
+						if (IsCore[j])
 						{
-							BestDist = Dist;
-							BestCore = j;
+							const double Dist = FVector::DistSquared(Positions[i], Positions[j]);
+							if (Dist < BestDist)
+							{
+								BestDist = Dist;
+								BestCore = j;
+							}
 						}
-					}
-				}
+						return true;
+					});
 
 				if (BestCore != INDEX_NONE)
 				{
@@ -124,13 +245,15 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 			else
 			{
 				// Connect to all reachable core points
-				for (const int32 j : Neighborhoods[i])
-				{
-					if (IsCore[j])
+				ForEachNeighbor(
+					i, [&](const int32 j)
 					{
-						OutEdges.Add(PCGEx::H64U(i, j));
-					}
-				}
+						if (IsCore[j])
+						{
+							OutEdges.Add(PCGEx::H64U(i, j));
+						}
+						return true;
+					});
 			}
 		}
 	}
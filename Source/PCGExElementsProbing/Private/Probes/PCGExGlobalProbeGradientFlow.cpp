@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeGradientFlow.h"
+#include "Core/PCGExMTCommon.h"
 
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -34,7 +35,12 @@ bool FPCGExProbeGradientFlow::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeGradientFlow::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeGradientFlow::SupportsScopedProcessing() const
+{
+	return true;
+}
+
+void FPCGExProbeGradientFlow::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -43,16 +49,10 @@ void FPCGExProbeGradientFlow::ProcessAll(TSet<uint64>& OutEdges) const
 		return;
 	}
 
-	const TArray<int8> CanGenerateRef = *CanGenerate;
-	const TArray<int8> AcceptConnectionsRef = *AcceptConnections;
-
-	// TODO : Use octree for faster queries, this is crude
-
-	// For each point, find K nearest neighbors
-	TArray<TPair<double, int32>> Distances;
-	Distances.SetNum(NumPoints);
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i])
 		{
@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeLevelSet.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 
@@ -47,7 +48,12 @@ bool FPCGExProbeLevelSet::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeLevelSet::SupportsScopedProcessing() const
+{
+	return true;
+}
+
+void FPCGExProbeLevelSet::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -68,7 +74,7 @@ void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
 		return Config.bNormalizeLevels ? (Raw - LevelMin) * NormFactor : Raw;
 	};
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i])
 		{
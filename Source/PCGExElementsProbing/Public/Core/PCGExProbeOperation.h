@@ -16,6 +16,7 @@
 namespace PCGExMT
 {
 	class FScopedContainer;
+	struct FScope;
 }
 
 namespace PCGExData
@@ -89,6 +90,18 @@ public:
 
 	virtual void ProcessAll(TSet<uint64>& OutEdges) const;
 
+	/** Global probes whose work is independent per point can be split in point ranges processed in parallel, instead of a single ProcessAll call. */
+	virtual bool SupportsScopedProcessing() const;
+
+	/** Number of passes over all points; a pass only starts once the previous one has completed for every scope. */
+	virtual int32 GetNumScopedPasses() const;
+
+	/** Called once before each pass, outside of any scope. Used to allocate per-point state shared across passes. */
+	virtual void PrepareScopedPass(const int32 Pass, const int32 NumPoints);
+
+	/** Processes the points within Scope. Per-point state may only be written for points in the scope; edges go into the scope buffer, duplicates are fine. */
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges);
+
 	FPCGExProbeConfigBase* BaseConfig = nullptr;
 	const PCGExOctree::FItemOctree* Octree = nullptr;
 	const TArray<FTransform>* WorkingTransforms = nullptr;
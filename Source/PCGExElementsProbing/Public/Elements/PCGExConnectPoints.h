@@ -20,6 +20,9 @@ namespace PCGExMT
 {
 	template <typename T>
 	class TScopedSet;
+
+	template <typename T>
+	class TScopedArray;
 }
 
 class UPCGExProbeFactoryData;
@@ -118,12 +121,14 @@ namespace PCGExConnectPoints
 		TArray<FPCGExProbeOperation*> ChainedOperations;
 		TArray<FPCGExProbeOperation*> SharedOperations;
 		TArray<FPCGExProbeOperation*> GlobalOperations;
+		TArray<FPCGExProbeOperation*> ScopedGlobalOperations;
 
 		int32 NumRadiusSources = 0;
 		int32 NumDirectOps = 0;
 		int32 NumChainedOps = 0;
 		int32 NumSharedOps = 0;
 		int32 NumGlobalOps = 0;
+		int32 NumScopedGlobalOps = 0;
 
 		bool bOnlyGlobalOps = false;
 		bool bWantsOctree = false;
@@ -144,6 +149,10 @@ namespace PCGExConnectPoints
 		TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
 		TSet<uint64> UniqueEdges;
 
+		// Per scoped global op : edges of the pass in flight, and everything collected so far (sorted & unique once done)
+		TArray<TSharedPtr<PCGExMT::TScopedArray<uint64>>> ScopedGlobalPassEdges;
+		TArray<TArray<uint64>> ScopedGlobalEdges;
+
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
 		bool bPreventCoincidence = false;
@@ -162,6 +171,7 @@ namespace PCGExConnectPoints
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		void OnPreparationComplete();
+		void StartScopedGlobalPass(const int32 OpIndex, const int32 Pass);
 		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void OnPointsProcessingComplete() override;
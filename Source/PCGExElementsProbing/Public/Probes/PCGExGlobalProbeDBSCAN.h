@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExH.h"
 #include "Core/PCGExProbeFactoryProvider.h"
 #include "Core/PCGExProbeOperation.h"
 
@@ -38,9 +39,23 @@ public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool WantsOctree() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual bool SupportsScopedProcessing() const override;
+	virtual int32 GetNumScopedPasses() const override;
+	virtual void PrepareScopedPass(const int32 Pass, const int32 NumPoints) override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges) override;
 
 	FPCGExProbeConfigDBSCAN Config;
+
+protected:
+	// Uniform grid whose cells are as large as the largest search radius, so neighbors are at most one cell away.
+	// Points are sorted by cell instead of storing per-point neighborhoods, memory stays linear.
+	double InvCellSize = 1;
+	TArray<PCGEx::FIndexKey> CellEntries; // Point index & cell key, sorted by key once binned
+	TMap<uint64, int32> CellStarts;       // Cell key -> first entry
+	TArray<int8> IsCore;
+
+	template <typename FUNC>
+	void ForEachNeighbor(const int32 Index, FUNC&& Func) const;
 };
 
 // Factory classes...
@@ -61,7 +61,8 @@ public:
 	virtual bool WantsOctree() const override;
 
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual bool SupportsScopedProcessing() const override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges) override;
 
 	FPCGExProbeConfigGradientFlow Config;
 	TSharedPtr<PCGExData::TBuffer<double>> FlowBuffer;
@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Elements/PCGExCreateShapes.h"
+#include "PCGExCoreSettingsCache.h"
 
 #include "Core/PCGExShape.h"
 #include "Core/PCGExShapeBuilderOperation.h"
@@ -74,32 +75,6 @@ bool FPCGExCreateShapesElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 
 namespace PCGExCreateShapes
 {
-	class FBuildShape final : public PCGExMT::FTask
-	{
-	public:
-		PCGEX_ASYNC_TASK_NAME(FBuildShape)
-
-		FBuildShape(const TSharedPtr<FPCGExShapeBuilderOperation>& InOperation, const TSharedRef<PCGExData::FFacade>& InShapeDataFacade, const TSharedPtr<PCGExShapes::FShape>& InShape)
-			: FTask()
-			  , ShapeDataFacade(InShapeDataFacade)
-			  , Operation(InOperation)
-			  , Shape(InShape)
-		{
-		}
-
-		TSharedRef<PCGExData::FFacade> ShapeDataFacade;
-		TSharedPtr<FPCGExShapeBuilderOperation> Operation;
-		TSharedPtr<PCGExShapes::FShape> Shape;
-
-		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager) override
-		{
-			FPCGExCreateShapesContext* Context = TaskManager->GetContext<FPCGExCreateShapesContext>();
-			PCGEX_SETTINGS(CreateShapes);
-
-			BuildShape(Context, ShapeDataFacade, Operation, Shape);
-		}
-	};
-
 	FProcessor::~FProcessor()
 	{
 	}
@@ -225,18 +200,22 @@ namespace PCGExCreateShapes
 		UPCGBasePointData* OutPointData = PointDataFacade->GetOut();
 		PCGExPointArrayDataHelpers::SetNumPointsAllocated(OutPointData, NumPoints);
 
+		JobFacades.Add(PointDataFacade);
+		BuildJobs.Reserve(NumSeeds * NumBuilders);
+
 		for (int i = 0; i < NumSeeds; i++)
 		{
 			for (int j = 0; j < NumBuilders; j++)
 			{
-				TSharedPtr<PCGExShapes::FShape> Shape = Builders[j]->Shapes[i];
-				if (!IsShapeValid(Shape))
+				if (!IsShapeValid(Builders[j]->Shapes[i]))
 				{
 					continue;
 				}
-				PCGEX_LAUNCH(FBuildShape, Builders[j], PointDataFacade, Shape)
+				BuildJobs.Emplace(j, i, 0);
 			}
 		}
+
+		StartBuildJobs(NumPoints);
 	}
 
 	void FProcessor::OutputPerSeed()
@@ -246,6 +225,10 @@ namespace PCGExCreateShapes
 
 		const int32 NumOutputs = NumSeeds * NumBuilders;
 		PerSeedFacades.Reserve(NumOutputs);
+		JobFacades.Reserve(NumSeeds);
+		BuildJobs.Reserve(NumOutputs);
+
+		int32 TotalPoints = 0;
 
 		for (int i = 0; i < NumSeeds; i++)
 		{
@@ -278,17 +261,21 @@ namespace PCGExCreateShapes
 			PerSeedFacades.Add(IOFacade);
 
 			PCGExPointArrayDataHelpers::SetNumPointsAllocated(IOFacade->GetOut(), NumPoints);
+			TotalPoints += NumPoints;
+
+			const int32 FacadeIndex = JobFacades.Add(IOFacade);
 
 			for (int j = 0; j < NumBuilders; j++)
 			{
-				TSharedPtr<PCGExShapes::FShape> Shape = Builders[j]->Shapes[i];
-				if (!IsShapeValid(Shape))
+				if (!IsShapeValid(Builders[j]->Shapes[i]))
 				{
 					continue;
 				}
-				PCGEX_LAUNCH(FBuildShape, Builders[j], IOFacade.ToSharedRef(), Shape)
+				BuildJobs.Emplace(j, i, FacadeIndex);
 			}
 		}
+
+		StartBuildJobs(TotalPoints);
 	}
 
 	void FProcessor::OutputPerShape()
@@ -335,7 +322,49 @@ namespace PCGExCreateShapes
 		}
 	}
 
-	void BuildShape(FPCGExCreateShapesContext* Context, const TSharedRef<PCGExData::FFacade>& ShapeDataFacade, const TSharedPtr<FPCGExShapeBuilderOperation>& Operation, const TSharedPtr<PCGExShapes::FShape>& Shape)
+	void FProcessor::StartBuildJobs(const int32 NumPoints)
+	{
+		if (BuildJobs.IsEmpty())
+		{
+			return;
+		}
+
+		// Output ranges are already allocated; shape id buffers are fetched once per output rather than once per shape
+		if (Settings->bWriteShapeId)
+		{
+			FPCGAttributeIdentifier Identifier = PCGExMetaHelpers::GetAttributeIdentifier(Settings->ShapeIdAttributeName);
+			Identifier.MetadataDomain = EPCGMetadataDomainFlag::Elements;
+
+			JobShapeIds.Reserve(JobFacades.Num());
+			for (const TSharedPtr<PCGExData::FFacade>& Facade : JobFacades)
+			{
+				JobShapeIds.Add(Facade->GetWritable<int32>(Identifier, PCGExData::EBufferInit::New));
+			}
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, BuildShapesTask)
+
+		BuildShapesTask->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				const FBuildJob& Job = This->BuildJobs[Index];
+				const TSharedPtr<FPCGExShapeBuilderOperation>& Builder = This->Builders[Job.BuilderIndex];
+
+				BuildShape(
+					This->Context, This->JobFacades[Job.FacadeIndex].ToSharedRef(), Builder, Builder->Shapes[Job.SeedIndex],
+					This->JobShapeIds.IsEmpty() ? nullptr : This->JobShapeIds[Job.FacadeIndex]);
+			}
+		};
+
+		// Shapes vary wildly in size; aim for roughly a points batch worth of output per sub-loop
+		const int32 AvgPointsPerShape = FMath::Max(1, NumPoints / BuildJobs.Num());
+		BuildShapesTask->StartSubLoops(BuildJobs.Num(), FMath::Max(1, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize() / AvgPointsPerShape));
+	}
+
+	void BuildShape(FPCGExCreateShapesContext* Context, const TSharedRef<PCGExData::FFacade>& ShapeDataFacade, const TSharedPtr<FPCGExShapeBuilderOperation>& Operation, const TSharedPtr<PCGExShapes::FShape>& Shape, const TSharedPtr<PCGExData::TBuffer<int32>>& InShapeIdBuffer)
 	{
 		PCGEX_SETTINGS(CreateShapes);
 
@@ -365,8 +394,12 @@ namespace PCGExCreateShapes
 			}
 			else
 			{
-				Identifier.MetadataDomain = EPCGMetadataDomainFlag::Elements;
-				const TSharedPtr<PCGExData::TBuffer<int32>> ShapeIdBuffer = ShapeDataFacade->GetWritable<int32>(Identifier, PCGExData::EBufferInit::New);
+				TSharedPtr<PCGExData::TBuffer<int32>> ShapeIdBuffer = InShapeIdBuffer;
+				if (!ShapeIdBuffer)
+				{
+					Identifier.MetadataDomain = EPCGMetadataDomainFlag::Elements;
+					ShapeIdBuffer = ShapeDataFacade->GetWritable<int32>(Identifier, PCGExData::EBufferInit::New);
+				}
 				const int32 MaxIndex = Shape->StartIndex + Shape->NumPoints;
 				for (int i = Shape->StartIndex; i < MaxIndex; i++)
 				{
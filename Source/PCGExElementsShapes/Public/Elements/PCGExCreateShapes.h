@@ -15,6 +15,12 @@ namespace PCGExShapes
 	class FShape;
 }
 
+namespace PCGExData
+{
+	template <typename T>
+	class TBuffer;
+}
+
 class FPCGExComputeIOBounds;
 
 
@@ -92,11 +98,28 @@ protected:
 
 namespace PCGExCreateShapes
 {
+	/** A valid shape, and the output facade it is written to. */
+	struct FBuildJob
+	{
+		int32 BuilderIndex = -1;
+		int32 SeedIndex = -1;
+		int32 FacadeIndex = -1;
+
+		FBuildJob(const int32 InBuilderIndex, const int32 InSeedIndex, const int32 InFacadeIndex)
+			: BuilderIndex(InBuilderIndex), SeedIndex(InSeedIndex), FacadeIndex(InFacadeIndex)
+		{
+		}
+	};
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExCreateShapesContext, UPCGExCreateShapesSettings>
 	{
 		TArray<TSharedPtr<FPCGExShapeBuilderOperation>> Builders;
 		TArray<TSharedPtr<PCGExData::FFacade>> PerSeedFacades;
 
+		TArray<FBuildJob> BuildJobs;
+		TArray<TSharedPtr<PCGExData::FFacade>> JobFacades;
+		TArray<TSharedPtr<PCGExData::TBuffer<int32>>> JobShapeIds;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -118,7 +141,9 @@ namespace PCGExCreateShapes
 		void OutputPerDataSet();
 		void OutputPerSeed();
 		void OutputPerShape();
+
+		void StartBuildJobs(const int32 NumPoints);
 	};
 
-	static void BuildShape(FPCGExCreateShapesContext* Context, const TSharedRef<PCGExData::FFacade>& ShapeDataFacade, const TSharedPtr<FPCGExShapeBuilderOperation>& Operation, const TSharedPtr<PCGExShapes::FShape>& Shape);
+	static void BuildShape(FPCGExCreateShapesContext* Context, const TSharedRef<PCGExData::FFacade>& ShapeDataFacade, const TSharedPtr<FPCGExShapeBuilderOperation>& Operation, const TSharedPtr<PCGExShapes::FShape>& Shape, const TSharedPtr<PCGExData::TBuffer<int32>>& InShapeIdBuffer = nullptr);
 }
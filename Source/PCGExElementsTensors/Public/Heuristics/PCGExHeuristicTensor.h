@@ -45,6 +45,12 @@ public:
 		return true;
 	}
 
+	// Same for the global score, sampled at From toward Goal.
+	virtual bool HasGoalOnlyGlobalScore() const override
+	{
+		return true;
+	}
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const override;
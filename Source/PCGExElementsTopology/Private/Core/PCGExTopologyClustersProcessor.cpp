@@ -79,7 +79,6 @@ bool FPCGExTopologyClustersProcessorElement::Boot(FPCGExContext* InContext) cons
 
 	GetInputFactories(Context, PCGExClusters::Labels::SourceEdgeConstrainsFiltersLabel, Context->EdgeConstraintsFilterFactories, PCGExFactories::ClusterEdgeFilters, false);
 
-	Context->HashMaps.Init(nullptr, Context->MainPoints->Num());
 	return true;
 }
 
@@ -109,8 +108,6 @@ namespace PCGExTopologyEdges
 		EdgeDataFacade->bSupportsScopedGet = true;
 		EdgeFilterFactories = &Context->EdgeConstraintsFilterFactories;
 
-		ProjectedHashMap = Context->HashMaps[VtxDataFacade->Source->IOIndex];
-
 		if (!PCGExClusterMT::IProcessor::Process(InTaskManager))
 		{
 			return false;
@@ -209,77 +206,9 @@ namespace PCGExTopologyEdges
 		FPlatformAtomics::InterlockedAdd(&ConstrainedEdgesNum, LocalConstrainedEdgesNum);
 	}
 
-	void IProcessor::ApplyPointData()
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TopologyClustersProcessor::ApplyPointData);
-
-		FPCGExTopologyClustersProcessorContext* Context = static_cast<FPCGExTopologyClustersProcessorContext*>(ExecutionContext);
-		const UPCGExTopologyClustersProcessorSettings* Settings = ExecutionContext->GetInputSettings<UPCGExTopologyClustersProcessorSettings>();
-
-		FTransform Transform = PCGExTopology::GetCoordinateSpaceTransform(Settings->Topology.CoordinateSpace, Context);
-
-		InternalMesh->EditMesh([&](FDynamicMesh3& InMesh)
-		{
-			const int32 VtxCount = InMesh.MaxVertexID();
-			const TConstPCGValueRange<FTransform> InTransforms = VtxDataFacade->GetIn()->GetConstTransformValueRange();
-			const TConstPCGValueRange<FVector4> InColors = VtxDataFacade->GetIn()->GetConstColorValueRange();
-			const TMap<uint64, int32>& HashMapRef = *ProjectedHashMap;
-
-			FVector4f DefaultVertexColor = FVector4f(Settings->Topology.DefaultVertexColor);
-
-			InMesh.EnableAttributes();
-			InMesh.Attributes()->EnablePrimaryColors();
-			InMesh.Attributes()->EnableMaterialID();
-
-			UE::Geometry::FDynamicMeshColorOverlay* Colors = InMesh.Attributes()->PrimaryColors();
-			UE::Geometry::FDynamicMeshMaterialAttribute* MaterialID = InMesh.Attributes()->GetMaterialID();
-
-			TArray<int32> VtxIDs;
-			VtxIDs.Init(-1, VtxCount);
-
-			TArray<int32> ElemIDs;
-			ElemIDs.SetNum(VtxCount);
-
-			for (int32 i = 0; i < VtxCount; i++)
-			{
-				ElemIDs[i] = Colors->AppendElement(DefaultVertexColor);
-			}
-
-			ParallelFor(VtxCount, [&](int32 i)
-			{
-				const int32* WP = HashMapRef.Find(PCGEx::GH2(InMesh.GetVertex(i), CWTolerance));
-				if (WP)
-				{
-					const int32 PointIndex = *WP;
-					VtxIDs[i] = PointIndex;
-					InMesh.SetVertex(i, Transform.InverseTransformPosition(InTransforms[PointIndex].GetLocation()));
-					Colors->SetElement(ElemIDs[i], FVector4f(InColors[PointIndex]));
-				}
-			});
-
-			TArray<int32> TriangleIDs;
-			TriangleIDs.Reserve(InMesh.TriangleCount());
-			for (int32 TriangleID : InMesh.TriangleIndicesItr())
-			{
-				TriangleIDs.Add(TriangleID);
-
-				const UE::Geometry::FIndex3i Triangle = InMesh.GetTriangle(TriangleID);
-				MaterialID->SetValue(TriangleID, 0);
-				Colors->SetTriangle(TriangleID, UE::Geometry::FIndex3i(ElemIDs[Triangle.A], ElemIDs[Triangle.B], ElemIDs[Triangle.C]));
-			}
-
-			UVDetails.Write(TriangleIDs, VtxIDs, InMesh);
-		}, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
-
-		Settings->Topology.PostProcessMesh(GetInternalMesh());
-	}
-
 	IBatch::IBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges)
 		: PCGExClusterMT::IBatch(InContext, InVtx, InEdges)
 	{
-		ProjectedHashMap = MakeShared<TMap<uint64, int32>>();
-		ProjectedHashMap->Reserve(InVtx->GetNum());
-		static_cast<FPCGExTopologyClustersProcessorContext*>(InContext)->HashMaps[InVtx->IOIndex] = ProjectedHashMap;
 	}
 
 	void IBatch::RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader)
@@ -308,21 +237,6 @@ namespace PCGExTopologyEdges
 		PCGEX_TYPED_CONTEXT_AND_SETTINGS(TopologyClustersProcessor)
 		PCGExClusterMT::IBatch::Output();
 	}
-
-	void IBatch::OnInitialPostProcess()
-	{
-		const int32 NumVtx = VtxDataFacade->GetNum();
-
-		TMap<uint64, int32>& MP = *ProjectedHashMap;
-		const TArray<FVector2D>& PP = *this->ProjectedVtxPositions.Get();
-
-		for (int i = 0; i < NumVtx; i++)
-		{
-			MP.Add(PCGEx::GH2(PP[i], CWTolerance), i);
-		}
-
-		PCGExClusterMT::IBatch::OnInitialPostProcess();
-	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -4,6 +4,7 @@
 #include "Data/PCGExGeoDynMesh.h"
 
 #include "PCGExH.h"
+#include "Core/PCGExMTCommon.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "DynamicMesh/DynamicMeshAttributeSet.h"
 #include "DynamicMesh/DynamicMeshOverlay.h"
@@ -123,7 +124,7 @@ namespace PCGExMesh
 		Internal::FDynMeshLookup MeshLookup(EstimatedVertices, &Vertices, &RawIndices, CWTolerance, bPreciseVertexMerge);
 
 		Edges.Reserve(Mesh.TriangleCount() * 3 / 2);
-		VertexIDToDenseIndex.Reserve(EstimatedVertices);
+		VertexIDToDenseIndex.Init(-1, EstimatedVertices);
 
 		for (const int32 TriID : Mesh.TriangleIndicesItr())
 		{
@@ -133,9 +134,9 @@ namespace PCGExMesh
 			const uint32 B = MeshLookup.Add_GetIdx(Mesh.GetVertex(Tri.B), Tri.B);
 			const uint32 C = MeshLookup.Add_GetIdx(Mesh.GetVertex(Tri.C), Tri.C);
 
-			VertexIDToDenseIndex.Add(Tri.A, A);
-			VertexIDToDenseIndex.Add(Tri.B, B);
-			VertexIDToDenseIndex.Add(Tri.C, C);
+			VertexIDToDenseIndex[Tri.A] = A;
+			VertexIDToDenseIndex[Tri.B] = B;
+			VertexIDToDenseIndex[Tri.C] = C;
 
 			if (A != B)
 			{
@@ -152,6 +153,7 @@ namespace PCGExMesh
 		}
 
 		DenseVertexCount = Vertices.Num();
+		BuildVertexCorners();
 		bIsLoaded = true;
 	}
 
@@ -185,7 +187,7 @@ namespace PCGExMesh
 		TMap<uint64, int32> EdgeMap;
 		EdgeMap.Reserve(NumTriangles * 3 / 2);
 
-		VertexIDToDenseIndex.Reserve(EstimatedVertices);
+		VertexIDToDenseIndex.Init(-1, EstimatedVertices);
 
 		auto PushAdjacency = [&](const int32 Tri, const int32 OtherTri)
 		{
@@ -232,9 +234,9 @@ namespace PCGExMesh
 			const uint32 B = MeshLookup.Add_GetIdx(Mesh.GetVertex(SrcTri.B), SrcTri.B);
 			const uint32 C = MeshLookup.Add_GetIdx(Mesh.GetVertex(SrcTri.C), SrcTri.C);
 
-			VertexIDToDenseIndex.Add(SrcTri.A, A);
-			VertexIDToDenseIndex.Add(SrcTri.B, B);
-			VertexIDToDenseIndex.Add(SrcTri.C, C);
+			VertexIDToDenseIndex[SrcTri.A] = A;
+			VertexIDToDenseIndex[SrcTri.B] = B;
+			VertexIDToDenseIndex[SrcTri.C] = C;
 
 			if (A == B || B == C || C == A)
 			{
@@ -294,52 +296,80 @@ namespace PCGExMesh
 		}
 
 		DenseVertexCount = Vertices.Num();
+		BuildVertexCorners();
 		bIsLoaded = true;
 	}
 
-	template <typename OverlayType, typename ValueType>
-	bool FGeoDynMesh::AverageOverlayPerVertex(const OverlayType* Overlay, TArray<ValueType>& OutValues) const
+	void FGeoDynMesh::BuildVertexCorners()
 	{
-		if (!Overlay || Overlay->ElementCount() == 0)
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGeoDynMesh::BuildVertexCorners);
+
+		const UE::Geometry::FDynamicMesh3& Mesh = *SourceMesh;
+
+		// Count corners per dense vertex, then prefix-sum into starts
+		VertexCornerStarts.Init(0, DenseVertexCount + 1);
+
+		for (const int32 TriID : Mesh.TriangleIndicesItr())
 		{
-			return false;
+			const UE::Geometry::FIndex3i Tri = Mesh.GetTriangle(TriID);
+			for (int i = 0; i < 3; i++)
+			{
+				VertexCornerStarts[VertexIDToDenseIndex[Tri[i]] + 1]++;
+			}
+		}
+
+		for (int32 i = 0; i < DenseVertexCount; i++)
+		{
+			VertexCornerStarts[i + 1] += VertexCornerStarts[i];
 		}
 
-		OutValues.SetNumZeroed(DenseVertexCount);
+		// Fill in triangle order, so per-vertex accumulation order matches a serial triangle scan
+		VertexCorners.SetNumUninitialized(VertexCornerStarts[DenseVertexCount]);
 
-		TArray<int32> Counts;
-		Counts.SetNumZeroed(DenseVertexCount);
+		TArray<int32> Cursors(VertexCornerStarts.GetData(), DenseVertexCount);
 
-		for (const int32 TriID : SourceMesh->TriangleIndicesItr())
+		for (const int32 TriID : Mesh.TriangleIndicesItr())
 		{
-			if (!Overlay->IsSetTriangle(TriID))
+			const UE::Geometry::FIndex3i Tri = Mesh.GetTriangle(TriID);
+			for (int i = 0; i < 3; i++)
 			{
-				continue;
+				VertexCorners[Cursors[VertexIDToDenseIndex[Tri[i]]]++] = TriID * 3 + i;
 			}
+		}
+	}
 
-			const UE::Geometry::FIndex3i SrcTri = SourceMesh->GetTriangle(TriID);
-			const UE::Geometry::FIndex3i ElemTri = Overlay->GetTriangle(TriID);
+	template <typename OverlayType, typename ValueType>
+	bool FGeoDynMesh::AverageOverlayPerVertex(const OverlayType* Overlay, TArray<ValueType>& OutValues) const
+	{
+		if (!Overlay || Overlay->ElementCount() == 0)
+		{
+			return false;
+		}
 
-			for (int i = 0; i < 3; i++)
+		OutValues.SetNumUninitialized(DenseVertexCount);
+
+		// Each dense vertex gathers from the corners it owns; no shared writes
+		PCGExMT::ParallelOrSequential(DenseVertexCount, [&](const int32 i)
+		{
+			ValueType Sum(ForceInitToZero);
+			int32 Count = 0;
+
+			for (int32 c = VertexCornerStarts[i]; c < VertexCornerStarts[i + 1]; c++)
 			{
-				const int32* DenseIdx = VertexIDToDenseIndex.Find(SrcTri[i]);
-				if (!DenseIdx)
+				const int32 Corner = VertexCorners[c];
+				const int32 TriID = Corner / 3;
+
+				if (!Overlay->IsSetTriangle(TriID))
 				{
 					continue;
 				}
 
-				OutValues[*DenseIdx] += Overlay->GetElement(ElemTri[i]);
-				Counts[*DenseIdx]++;
+				Sum += Overlay->GetElement(Overlay->GetTriangle(TriID)[Corner % 3]);
+				Count++;
 			}
-		}
 
-		for (int i = 0; i < DenseVertexCount; i++)
-		{
-			if (Counts[i] > 1)
-			{
-				OutValues[i] /= static_cast<float>(Counts[i]);
-			}
-		}
+			OutValues[i] = Count > 1 ? Sum / static_cast<float>(Count) : Sum;
+		});
 
 		return true;
 	}
@@ -353,11 +383,11 @@ namespace PCGExMesh
 			TArray<ValueType> Centroids;
 			Centroids.SetNumZeroed(Triangles.Num());
 
-			for (int32 i = 0; i < Triangles.Num(); i++)
+			PCGExMT::ParallelOrSequential(Triangles.Num(), [&](const int32 i)
 			{
 				const FIntVector3& Triangle = Triangles[i];
-				Centroids[i] = (Values[VertexIDToDenseIndex.FindChecked(Triangle.X)] + Values[VertexIDToDenseIndex.FindChecked(Triangle.Y)] + Values[VertexIDToDenseIndex.FindChecked(Triangle.Z)]) / 3.f;
-			}
+				Centroids[i] = (Values[VertexIDToDenseIndex[Triangle.X]] + Values[VertexIDToDenseIndex[Triangle.Y]] + Values[VertexIDToDenseIndex[Triangle.Z]]) / 3.f;
+			});
 
 			Values = MoveTemp(Centroids);
 		}
@@ -366,11 +396,11 @@ namespace PCGExMesh
 			// Centroids are appended after the original dense vertices; Triangles hold dense indices.
 			Values.SetNumZeroed(DenseVertexCount + Triangles.Num());
 
-			for (int32 i = 0; i < Triangles.Num(); i++)
+			PCGExMT::ParallelOrSequential(Triangles.Num(), [&](const int32 i)
 			{
 				const FIntVector3& Triangle = Triangles[i];
 				Values[DenseVertexCount + i] = (Values[Triangle.X] + Values[Triangle.Y] + Values[Triangle.Z]) / 3.f;
-			}
+			});
 		}
 	}
 
@@ -438,15 +468,18 @@ namespace PCGExMesh
 			// Merged vertices accumulate; normalize so dual/hollow averaging weighs each dense vertex equally.
 			OutNormals.SetNumZeroed(DenseVertexCount);
 
-			for (const TPair<int32, int32>& Pair : VertexIDToDenseIndex)
+			for (int32 VtxID = 0; VtxID < VertexIDToDenseIndex.Num(); VtxID++)
 			{
-				OutNormals[Pair.Value] += SourceMesh->GetVertexNormal(Pair.Key);
+				if (const int32 DenseIdx = VertexIDToDenseIndex[VtxID]; DenseIdx != -1)
+				{
+					OutNormals[DenseIdx] += SourceMesh->GetVertexNormal(VtxID);
+				}
 			}
 
-			for (FVector3f& Normal : OutNormals)
+			PCGExMT::ParallelOrSequential(DenseVertexCount, [&](const int32 i)
 			{
-				Normal.Normalize();
-			}
+				OutNormals[i].Normalize();
+			});
 
 			bHasNormals = true;
 		}
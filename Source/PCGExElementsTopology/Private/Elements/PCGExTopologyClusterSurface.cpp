@@ -3,12 +3,14 @@
 
 #include "Elements/PCGExTopologyClusterSurface.h"
 
+#include "PCGExCoreSettingsCache.h"
+#include "UDynamicMesh.h"
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/Artifacts/PCGExCellDetails.h"
 #include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
+#include "CompGeom/PolygonTriangulation.h"
+#include "Containers/PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
-#include "GeometryScript/MeshPrimitiveFunctions.h"
-#include "GeometryScript/PolygonFunctions.h"
 
 #define LOCTEXT_NAMESPACE "TopologyClustersProcessor"
 #define PCGEX_NAMESPACE TopologyClustersProcessor
@@ -81,59 +83,274 @@ namespace PCGExTopologyClusterSurface
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::CompleteWork);
 
-		// Build polygons from enumerated cells
-		FGeometryScriptGeneralPolygonList ClusterPolygonList;
-		ClusterPolygonList.Reset();
+		ValidCells.RemoveAll([](const TSharedPtr<PCGExClusters::FCell>& Cell)
+		{
+			return !Cell || Cell->Polygon.IsEmpty() || Cell->Polygon.Num() != Cell->Nodes.Num();
+		});
+
+		// Handle wrapper cell as sole path if needed
+		if (ValidCells.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
+		{
+			ValidCells.Add(CellsConstraints->WrapperCell);
+		}
+
+		if (ValidCells.IsEmpty())
+		{
+			bIsProcessorValid = false;
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, TriangulateCellsTask)
+
+		TriangulateCellsTask->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
+		{
+			PCGEX_ASYNC_THIS
+			This->AssembleMesh();
+		};
+
+		TriangulateCellsTask->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+		{
+			PCGEX_ASYNC_THIS
+			This->ScopedTriangles = MakeShared<PCGExMT::TScopedArray<FIntVector4>>(Loops);
+		};
+
+		TriangulateCellsTask->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->TriangulateCells(Scope);
+		};
 
-		TArray<FGeometryScriptSimplePolygon> Polygons;
-		Polygons.Reserve(ValidCells.Num() + 1);
+		TriangulateCellsTask->StartSubLoops(ValidCells.Num(), PCGEX_CORE_SETTINGS.ClusterDefaultBatchChunkSize);
+	}
+
+	void FProcessor::TriangulateCells(const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::TriangulateCells);
+
+		TArray<FIntVector4>& OutTriangles = ScopedTriangles->Get_Ref(Scope);
+
+		const bool bStopOnFirstError = Settings->Topology.TriangulationOptions.bStopOnFirstError;
 
-		for (const TSharedPtr<PCGExClusters::FCell>& Cell : ValidCells)
+		TArray<int32> Indices;
+		TArray<FVector2D> Positions;
+		TArray<UE::Geometry::FIndex3i> Triangles;
+
+		PCGEX_SCOPE_LOOP(CellIndex)
 		{
-			if (!Cell || Cell->Polygon.IsEmpty())
+			const PCGExClusters::FCell* Cell = ValidCells[CellIndex].Get();
+			const TArray<int32>& Nodes = Cell->Nodes;
+
+			// Cells walk dead-ends back and forth (A, B, A); drop those spurs so the loop can be ear-clipped
+			Indices.Reset(Nodes.Num());
+			for (int32 i = 0; i < Nodes.Num(); i++)
+			{
+				if (!Indices.IsEmpty() && Nodes[Indices.Last()] == Nodes[i])
+				{
+					continue;
+				}
+
+				Indices.Add(i);
+
+				while (Indices.Num() >= 3 && Nodes[Indices.Last()] == Nodes[Indices.Last(2)])
+				{
+					Indices.Pop(EAllowShrinking::No);
+					Indices.Pop(EAllowShrinking::No);
+				}
+			}
+
+			// Same thing across the seam
+			bool bStripped = true;
+			while (bStripped && Indices.Num() >= 3)
+			{
+				bStripped = false;
+				if (Nodes[Indices[0]] == Nodes[Indices.Last()])
+				{
+					Indices.Pop(EAllowShrinking::No);
+					bStripped = true;
+				}
+				else if (Nodes[Indices[1]] == Nodes[Indices.Last()])
+				{
+					Indices.Pop(EAllowShrinking::No);
+					Indices.RemoveAt(0);
+					bStripped = true;
+				}
+				else if (Nodes[Indices[0]] == Nodes[Indices.Last(1)])
+				{
+					Indices.Pop(EAllowShrinking::No);
+					Indices.Pop(EAllowShrinking::No);
+					bStripped = true;
+				}
+			}
+
+			const int32 NumVertices = Indices.Num();
+			if (NumVertices < 3)
 			{
 				continue;
 			}
 
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(Cell->Polygon.Num());
-			Polygon.Vertices->Append(Cell->Polygon);
+			Positions.SetNumUninitialized(NumVertices);
+			for (int32 i = 0; i < NumVertices; i++)
+			{
+				Positions[i] = Cell->Polygon[Indices[i]];
+			}
+
+			Triangles.Reset();
+			PolygonTriangulation::TriangulateSimplePolygon<double>(Positions, Triangles, false);
+
+			if (Triangles.Num() != NumVertices - 2)
+			{
+				FPlatformAtomics::InterlockedExchange(&bTriangulationError, 1);
+
+				// Scopes run in any order; keep the lowest failing cell so the result matches a sequential run
+				int32 Current = FirstFailedCell;
+				while (CellIndex < Current)
+				{
+					const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&FirstFailedCell, CellIndex, Current);
+					if (Previous == Current)
+					{
+						break;
+					}
+					Current = Previous;
+				}
+
+				if (bStopOnFirstError)
+				{
+					continue;
+				}
+			}
+
+			for (const UE::Geometry::FIndex3i& Triangle : Triangles)
+			{
+				int32 A = Cluster->GetNodePointIndex(Nodes[Indices[Triangle.A]]);
+				int32 B = Cluster->GetNodePointIndex(Nodes[Indices[Triangle.B]]);
+				int32 C = Cluster->GetNodePointIndex(Nodes[Indices[Triangle.C]]);
+
+				if (A == B || B == C || C == A)
+				{
+					continue;
+				}
+
+				// Consistent facing regardless of the cell winding
+				const double Cross = FVector2D::CrossProduct(Positions[Triangle.B] - Positions[Triangle.A], Positions[Triangle.C] - Positions[Triangle.A]);
+				if ((Cross < 0) != Settings->Topology.PrimitiveOptions.bFlipOrientation)
+				{
+					Swap(B, C);
+				}
+
+				OutTriangles.Emplace(A, B, C, CellIndex);
+			}
 		}
+	}
 
-		// Handle wrapper cell as sole path if needed
-		if (Polygons.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
+	void FProcessor::AssembleMesh()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::AssembleMesh);
+
+		TArray<FIntVector4> Triangles;
+		ScopedTriangles->Collapse(Triangles);
+		ScopedTriangles.Reset();
+
+		const bool bStopOnFirstError = Settings->Topology.TriangulationOptions.bStopOnFirstError;
+		if (bStopOnFirstError && FirstFailedCell != MAX_int32)
 		{
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(CellsConstraints->WrapperCell->Polygon.Num());
-			Polygon.Vertices->Append(CellsConstraints->WrapperCell->Polygon);
+			Triangles.RemoveAll([&](const FIntVector4& Triangle) { return Triangle.W > FirstFailedCell; });
 		}
 
-		if (Polygons.IsEmpty())
+		if (Triangles.IsEmpty())
 		{
 			bIsProcessorValid = false;
 			return;
 		}
 
-		UGeometryScriptLibrary_PolygonListFunctions::AppendPolygonList(
-			ClusterPolygonList,
-			UGeometryScriptLibrary_PolygonListFunctions::CreatePolygonListFromSimplePolygons(Polygons));
+		const FTransform Transform = PCGExTopology::GetCoordinateSpaceTransform(Settings->Topology.CoordinateSpace, Context);
+		const bool bSingleGroup = Settings->Topology.PrimitiveOptions.PolygroupMode == EGeometryScriptPrimitivePolygroupMode::SingleGroup;
 
-		bool bTriangulationError = false;
+		InternalMesh->EditMesh([&](FDynamicMesh3& InMesh)
+		{
+			const TConstPCGValueRange<FTransform> InTransforms = VtxDataFacade->GetIn()->GetConstTransformValueRange();
+			const TConstPCGValueRange<FVector4> InColors = VtxDataFacade->GetIn()->GetConstColorValueRange();
+
+			InMesh.EnableTriangleGroups();
+			InMesh.EnableAttributes();
+			InMesh.Attributes()->EnablePrimaryColors();
+			InMesh.Attributes()->EnableMaterialID();
+
+			UE::Geometry::FDynamicMeshColorOverlay* Colors = InMesh.Attributes()->PrimaryColors();
+			UE::Geometry::FDynamicMeshMaterialAttribute* MaterialID = InMesh.Attributes()->GetMaterialID();
+
+			// Cells share their boundary nodes, so each point becomes a single welded vertex;
+			// overlapping cells (e.g. the wrapper) fall back to their own vertices, see below
+			TArray<int32> PointToVertex;
+			PointToVertex.Init(-1, InTransforms.Num());
+
+			TArray<int32> VtxIDs;    // Vertex ID -> point index
+			TArray<int32> ElemIDs;   // Vertex ID -> color element
+			TArray<int32> TriangleIDs;
+
+			VtxIDs.Reserve(Triangles.Num());
+			ElemIDs.Reserve(Triangles.Num());
+			TriangleIDs.Reserve(Triangles.Num());
+
+			auto AppendVertex = [&](const int32 PointIndex)
+			{
+				const int32 VtxID = InMesh.AppendVertex(Transform.InverseTransformPosition(InTransforms[PointIndex].GetLocation()));
+				VtxIDs.SetNum(VtxID + 1);
+				ElemIDs.SetNum(VtxID + 1);
+				VtxIDs[VtxID] = PointIndex;
+				ElemIDs[VtxID] = Colors->AppendElement(FVector4f(InColors[PointIndex]));
+				return VtxID;
+			};
+
+			auto GetVertex = [&](const int32 PointIndex)
+			{
+				int32& VtxID = PointToVertex[PointIndex];
+				if (VtxID == -1)
+				{
+					VtxID = AppendVertex(PointIndex);
+				}
+				return VtxID;
+			};
+
+			for (const FIntVector4& Triangle : Triangles)
+			{
+				const int32 GroupID = bSingleGroup ? 0 : Triangle.W;
+
+				UE::Geometry::FIndex3i Tri(GetVertex(Triangle.X), GetVertex(Triangle.Y), GetVertex(Triangle.Z));
+				int32 TriangleID = InMesh.AppendTriangle(Tri, GroupID);
+
+				if (TriangleID < 0)
+				{
+					// Overlapping cells put a third triangle on a shared edge; give this one its own vertices,
+					// as they would have been without welding
+					Tri = UE::Geometry::FIndex3i(AppendVertex(Triangle.X), AppendVertex(Triangle.Y), AppendVertex(Triangle.Z));
+					TriangleID = InMesh.AppendTriangle(Tri, GroupID);
+				}
+
+				if (TriangleID < 0)
+				{
+					// Invalid triangle
+					bTriangulationError = 1;
+					if (bStopOnFirstError)
+					{
+						break;
+					}
+					continue;
+				}
+
+				TriangleIDs.Add(TriangleID);
+				MaterialID->SetValue(TriangleID, 0);
+				Colors->SetTriangle(TriangleID, UE::Geometry::FIndex3i(ElemIDs[Tri.A], ElemIDs[Tri.B], ElemIDs[Tri.C]));
+			}
 
-		UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendPolygonListTriangulation(
-			GetInternalMesh(),
-			Settings->Topology.PrimitiveOptions,
-			FTransform::Identity,
-			ClusterPolygonList,
-			Settings->Topology.TriangulationOptions,
-			bTriangulationError);
+			UVDetails.Write(TriangleIDs, VtxIDs, InMesh);
+		}, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
 
 		if (bTriangulationError && !Settings->Topology.bQuietTriangulationError)
 		{
 			PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("Triangulation error."));
 		}
 
-		ApplyPointData();
+		Settings->Topology.PostProcessMesh(GetInternalMesh());
 	}
 
 	FBatch::FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges)
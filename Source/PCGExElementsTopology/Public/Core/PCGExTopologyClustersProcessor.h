@@ -78,7 +78,6 @@ struct PCGEXELEMENTSTOPOLOGY_API FPCGExTopologyClustersProcessorContext : FPCGEx
 
 	TSharedPtr<PCGExClusters::FProjectedPointSet> Holes;
 	TSharedPtr<PCGExData::FFacade> HolesFacade;
-	TArray<TSharedPtr<TMap<uint64, int32>>> HashMaps;
 
 	virtual void RegisterAssetDependencies() override;
 };
@@ -106,7 +105,6 @@ namespace PCGExTopologyEdges
 		TSharedPtr<PCGExClusters::FProjectedPointSet> Holes;
 		FPCGExTopologyUVDetails UVDetails;
 
-		const FVector2D CWTolerance = FVector2D(0.001);
 		bool bIsPreviewMode = false;
 
 		TSharedPtr<PCGExClusters::FCell> WrapperCell;
@@ -120,8 +118,6 @@ namespace PCGExTopologyEdges
 		int32 ConstrainedEdgesNum = 0;
 
 	public:
-		TSharedPtr<TMap<uint64, int32>> ProjectedHashMap;
-
 		TObjectPtr<UDynamicMesh> GetInternalMesh()
 		{
 			return InternalMesh;
@@ -140,7 +136,6 @@ namespace PCGExTopologyEdges
 
 	protected:
 		void FilterConstrainedEdgeScope(const PCGExMT::FScope& Scope);
-		void ApplyPointData();
 	};
 
 	template <typename TContext, typename TSettings>
@@ -180,18 +175,11 @@ namespace PCGExTopologyEdges
 
 	class PCGEXELEMENTSTOPOLOGY_API IBatch : public PCGExClusterMT::IBatch
 	{
-	protected:
-		const FVector2D CWTolerance = FVector2D(0.001);
-		TSharedPtr<TMap<uint64, int32>> ProjectedHashMap;
-
 	public:
 		IBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges);
 
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
 		virtual void Output() override;
-
-	protected:
-		virtual void OnInitialPostProcess() override;
 	};
 
 	template <typename T>
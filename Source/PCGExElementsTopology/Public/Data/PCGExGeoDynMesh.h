@@ -68,12 +68,22 @@ namespace PCGExMesh
 		bool GetAveragedVertexNormals(TArray<FVector3f>& OutNormals) const;
 
 	private:
-		/** Maps sparse source vertex ID → dense output vertex index. Built during extraction. */
-		TMap<int32, int32> VertexIDToDenseIndex;
+		/** Maps sparse source vertex ID → dense output vertex index (-1 if unused), sized from MaxVertexID. Built during extraction. */
+		TArray<int32> VertexIDToDenseIndex;
 
 		/** Dense vertex count at extraction time, before MakeDual/MakeHollowDual mutate the vertex array. */
 		int32 DenseVertexCount = 0;
 
+		/**
+		 * Source triangle corners (TriID * 3 + corner) owned by each dense vertex, CSR layout:
+		 * corners of vertex i are VertexCorners[VertexCornerStarts[i] .. VertexCornerStarts[i + 1]).
+		 * Lets overlay averaging run per dense vertex in parallel without atomics.
+		 */
+		TArray<int32> VertexCornerStarts;
+		TArray<int32> VertexCorners;
+
+		void BuildVertexCorners();
+
 		/** Averages overlay elements per dense vertex (pre-dual index space). */
 		template <typename OverlayType, typename ValueType>
 		bool AverageOverlayPerVertex(const OverlayType* Overlay, TArray<ValueType>& OutValues) const;
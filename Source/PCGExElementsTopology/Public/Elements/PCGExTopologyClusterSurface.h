@@ -11,6 +11,12 @@
 
 #include "PCGExTopologyClusterSurface.generated.h"
 
+namespace PCGExMT
+{
+	template <typename T>
+	class TScopedArray;
+}
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Clusters", meta=(Keywords = "collision"), meta=(PCGExNodeLibraryDoc="topology/topology-cluster-surface"))
 class UPCGExTopologyClusterSurfaceSettings : public UPCGExTopologyClustersProcessorSettings
 {
@@ -60,6 +66,13 @@ namespace PCGExTopologyClusterSurface
 	{
 		TArray<TSharedPtr<PCGExClusters::FCell>> ValidCells;
 
+		// Per-scope triangles, as (point index A, B, C, cell index)
+		TSharedPtr<PCGExMT::TScopedArray<FIntVector4>> ScopedTriangles;
+		int8 bTriangulationError = 0;
+
+		// Lowest cell index that failed to triangulate; with bStopOnFirstError, it and every later cell are left out
+		int32 FirstFailedCell = MAX_int32;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -72,6 +85,10 @@ namespace PCGExTopologyClusterSurface
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		void TriangulateCells(const PCGExMT::FScope& Scope);
+		void AssembleMesh();
 	};
 
 	class FBatch final : public PCGExTopologyEdges::TBatch<FProcessor>
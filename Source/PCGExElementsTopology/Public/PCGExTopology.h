@@ -129,7 +129,8 @@ struct PCGEXELEMENTSTOPOLOGY_API FPCGExTopologyDetails
 	FGeometryScriptPrimitiveOptions PrimitiveOptions;
 
 	/** Triangulation options
-	 * Note that those are applied when triangulation is appended to the dynamic mesh. */
+	 * Note that those are applied when triangulation is appended to the dynamic mesh.
+	 * Cluster Surface only uses Stop On First Error: the first cell that fails, and every cell after it, are left out. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	FGeometryScriptPolygonsTriangulationOptions TriangulationOptions;
 
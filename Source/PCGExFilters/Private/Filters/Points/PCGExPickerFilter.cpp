@@ -33,17 +33,13 @@ bool PCGExPointFilter::FPickerFilter::Init(FPCGExContext* InContext, const TShar
 		return false;
 	}
 
-	for (const TObjectPtr<const UPCGExPickerFactoryData>& FactoryData : TypedFilterFactory->PickerFactories)
-	{
-		FactoryData->AddPicks(InPointDataFacade->GetNum(), Picks);
-	}
-
-	return true;
+	Picks = PCGExPickers::GetPicks(TypedFilterFactory->PickerFactories, InPointDataFacade);
+	return Picks.IsValid();
 }
 
 bool PCGExPointFilter::FPickerFilter::Test(const int32 PointIndex) const
 {
-	return TypedFilterFactory->Config.bInvert ? !Picks.Contains(PointIndex) : Picks.Contains(PointIndex);
+	return TypedFilterFactory->Config.bInvert ? !Picks->Contains(PointIndex) : Picks->Contains(PointIndex);
 }
 
 bool PCGExPointFilter::FPickerFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
@@ -56,9 +52,7 @@ bool PCGExPointFilter::FPickerFilter::Test(const TSharedPtr<PCGExData::FPointIO>
 	const int32 NumEntries = ParentCollection->Num();
 	for (const TObjectPtr<const UPCGExPickerFactoryData>& FactoryData : TypedFilterFactory->PickerFactories)
 	{
-		TSet<int32> TempPicks;
-		FactoryData->AddPicks(NumEntries, TempPicks);
-		if (TempPicks.Contains(IO->IOIndex))
+		if (FactoryData->GetPicks(NumEntries)->Contains(IO->IOIndex))
 		{
 			return !TypedFilterFactory->Config.bInvert;
 		}
@@ -13,6 +13,11 @@
 
 class UPCGExPickerFactoryData;
 
+namespace PCGExPickers
+{
+	class FPickSet;
+}
+
 USTRUCT(BlueprintType)
 struct PCGEXFILTERS_API FPCGExPickerFilterConfig
 {
@@ -77,7 +82,7 @@ namespace PCGExPointFilter
 		}
 
 	protected:
-		TSet<int32> Picks;
+		TSharedPtr<const PCGExPickers::FPickSet> Picks;
 	};
 }
 
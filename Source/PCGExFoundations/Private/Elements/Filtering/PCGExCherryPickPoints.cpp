@@ -86,11 +86,10 @@ namespace PCGExCherryPickPoints
 
 		PointDataFacade->Source->bAllowEmptyOutput = Settings->bAllowEmptyOutputs;
 
-		TSet<int32> UniqueIndices;
 		// Grab picks
-		PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade, UniqueIndices);
+		const TSharedPtr<const PCGExPickers::FPickSet> Picks = PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade);
 
-		if (UniqueIndices.IsEmpty())
+		if (!Picks || Picks->IsEmpty())
 		{
 			if (Settings->bOutputDiscardedPoints)
 			{
@@ -121,7 +120,7 @@ namespace PCGExCherryPickPoints
 
 		const UPCGBasePointData* SourcePoints = PointDataFacade->GetIn();
 		const int32 NumPoints = SourcePoints->GetNumPoints();
-		const int32 NumPicks = FMath::Min(UniqueIndices.Num(), NumPoints);
+		const int32 NumPicks = FMath::Min(Picks->NumPicked(), NumPoints);
 
 		TArray<int32> PickedIndices;
 		TArray<int32> DiscardedIndices;
@@ -133,7 +132,7 @@ namespace PCGExCherryPickPoints
 		{
 			for (int i = 0; i < NumPoints; i++)
 			{
-				if (!UniqueIndices.Contains(i))
+				if (!Picks->Contains(i))
 				{
 					PickedIndices.Add(i);
 				}
@@ -147,7 +146,7 @@ namespace PCGExCherryPickPoints
 		{
 			for (int i = 0; i < NumPoints; i++)
 			{
-				if (UniqueIndices.Contains(i))
+				if (Picks->Contains(i))
 				{
 					PickedIndices.Add(i);
 				}
@@ -194,7 +194,8 @@ namespace PCGExUberFilter
 
 		PCGEX_INIT_IO(PointDataFacade->Source, Settings->GetMainDataInitializationPolicy())
 
-		bUsePicks = PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade, Picks);
+		Picks = PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade);
+		bUsePicks = Picks.IsValid();
 
 		if (Settings->Mode == EPCGExUberFilterMode::Write)
 		{
@@ -236,7 +237,7 @@ namespace PCGExUberFilter
 		{
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				if (!Picks.Contains(Index))
+				if (!Picks->Contains(Index))
 				{
 					PointFilterCache[Index] = Settings->UnpickedFallback == EPCGExFilterFallback::Pass;
 				}
@@ -181,8 +181,9 @@ namespace PCGExUberFilterCollections
 
 		PointDataFacade->Source->bAllowEmptyOutput = true;
 
-		bUsePicks = PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade, Picks);
-		NumPoints = bUsePicks ? Picks.Num() : PointDataFacade->GetNum();
+		Picks = PCGExPickers::GetPicks(Context->PickerFactories, PointDataFacade);
+		bUsePicks = Picks.IsValid();
+		NumPoints = bUsePicks ? Picks->NumPicked() : PointDataFacade->GetNum();
 
 		if (Settings->Measure == EPCGExMeanMeasure::Discrete)
 		{
@@ -210,7 +211,7 @@ namespace PCGExUberFilterCollections
 		{
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				if (!Picks.Contains(Index))
+				if (!Picks->Contains(Index))
 				{
 					continue;
 				}
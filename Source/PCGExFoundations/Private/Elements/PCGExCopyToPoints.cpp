@@ -9,6 +9,8 @@
 #include "Fitting/PCGExFittingTasks.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Helpers/PCGExMatchingHelpers.h"
+#include "Helpers/PCGExMetaHelpers.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
 
 #define LOCTEXT_NAMESPACE "PCGExCopyToPointsElement"
 #define PCGEX_NAMESPACE CopyToPoints
@@ -69,6 +71,19 @@ bool FPCGExCopyToPointsElement::Boot(FPCGExContext* InContext) const
 
 	Context->TargetsForwardHandler = Settings->TargetsForwarding.GetHandler(Context->TargetsDataFacade);
 
+	if (Settings->bMergeCopies)
+	{
+		if (Settings->bWriteCopyIndex)
+		{
+			PCGEX_VALIDATE_NAME(Settings->CopyIndexAttributeName)
+		}
+
+		if (Context->TargetsAttributesToCopyTags.bAddIndexTag || !Context->TargetsAttributesToCopyTags.Getters.IsEmpty())
+		{
+			PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("Target attributes to tags are ignored when merging copies; tags cannot vary per copy within a single data."));
+		}
+	}
+
 	return true;
 }
 
@@ -114,6 +129,12 @@ namespace PCGExCopyToPoints
 
 		MatchScope = PCGExMatching::FScope(Context->InitialMainPointsNum);
 
+		bMergeCopies = Settings->bMergeCopies;
+		if (bMergeCopies)
+		{
+			return PrepareMergedCopies();
+		}
+
 		const UPCGBasePointData* Targets = Context->TargetsDataFacade->GetIn();
 		const int32 NumTargets = Targets->GetNumPoints();
 
@@ -124,8 +145,175 @@ namespace PCGExCopyToPoints
 		return true;
 	}
 
+	bool FProcessor::PrepareMergedCopies()
+	{
+		const int32 NumTargets = Context->TargetsDataFacade->GetNum();
+		const FPCGExTaggedData AsCandidate = PointDataFacade->Source->GetTaggedData();
+
+		// Resolve matches up front so the merged output can be sized once
+		TArray<int8> Matches;
+		Matches.Init(0, NumTargets);
+
+		PCGExMT::ParallelOrSequential(
+			NumTargets, [&](const int32 i)
+			{
+				Matches[i] = Context->DataMatcher->Test(Context->TargetsDataFacade->GetInPoint(i), AsCandidate, MatchScope);
+			}, 32);
+
+		NumCopies = PCGExArrayHelpers::ArrayOfIndices(CopyTargets, Matches, 0);
+		if (NumCopies == 0)
+		{
+			return true;
+		}
+
+		NumSourcePoints = PointDataFacade->GetNum();
+		const int64 NumMergedPoints = static_cast<int64>(NumCopies) * NumSourcePoints;
+		if (NumMergedPoints > MAX_int32)
+		{
+			PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("Merged copies would exceed the maximum number of points a single data can hold."));
+			return false;
+		}
+
+		const TSharedPtr<PCGExData::FPointIO> MergedIO = Context->MainPoints->Emplace_GetRef(PointDataFacade->Source, PCGExData::EIOInit::New);
+		if (!MergedIO)
+		{
+			return false;
+		}
+
+		MergedDataFacade = MakeShared<PCGExData::FFacade>(MergedIO.ToSharedRef());
+
+		const EPCGPointNativeProperties Allocations = MergedIO->GetAllocations();
+		PCGExPointArrayDataHelpers::SetNumPointsAllocated(MergedIO->GetOut(), NumMergedPoints, Allocations | EPCGPointNativeProperties::Transform | EPCGPointNativeProperties::MetadataEntry);
+
+		// Transforms are written from the input when processing copies; everything else, metadata entries included,
+		// is inherited as-is, so copies reference the input's attribute values instead of duplicating them.
+		PCGExMT::ParallelOrSequential(
+			NumCopies, [&](const int32 i)
+			{
+				MergedIO->InheritProperties(0, i * NumSourcePoints, NumSourcePoints, Allocations & ~EPCGPointNativeProperties::Transform);
+			}, 8);
+
+		// Every copy shares the same input bounds; only the target changes
+		const UPCGBasePointData* InPoints = PointDataFacade->GetIn();
+		const TConstPCGValueRange<FTransform> InTransforms = InPoints->GetConstTransformValueRange();
+
+		FBox SourceBounds = FBox(ForceInit);
+		if (!Context->TransformDetails.bIgnoreBounds)
+		{
+			for (int i = 0; i < NumSourcePoints; i++)
+			{
+				SourceBounds += InPoints->GetLocalBounds(i).TransformBy(InTransforms[i]);
+			}
+		}
+		else
+		{
+			for (const FTransform& Pt : InTransforms)
+			{
+				SourceBounds += Pt.GetLocation();
+			}
+		}
+
+		SourceBounds = SourceBounds.ExpandBy(0.1); // Avoid NaN
+
+		CopyTransforms.SetNumUninitialized(NumCopies);
+		PCGExMT::ParallelOrSequential(
+			NumCopies, [&](const int32 i)
+			{
+				FBox Bounds = SourceBounds;
+				FVector Translation = FVector::ZeroVector;
+				CopyTransforms[i] = FTransform::Identity;
+				Context->TransformDetails.ComputeTransform(CopyTargets[i], CopyTransforms[i], Bounds, Translation);
+			});
+
+		if (Settings->bWriteCopyIndex)
+		{
+			CopyIndexWriter = MergedDataFacade->GetWritable<int32>(Settings->CopyIndexAttributeName, -1, false, PCGExData::EBufferInit::New);
+		}
+
+		MergedForwardHandler = Settings->TargetsForwarding.TryGetHandler(Context->TargetsDataFacade, MergedDataFacade, false);
+		if (MergedForwardHandler && MergedForwardHandler->IsEmpty())
+		{
+			MergedForwardHandler = nullptr;
+		}
+
+		// Per-point values need per-point entries; parented to the inherited ones so input attributes still resolve.
+		if (CopyIndexWriter || MergedForwardHandler)
+		{
+			MergedIO->InitializeMetadataEntries_Unsafe(false);
+		}
+
+		StartParallelLoopForRange(NumCopies, 1);
+
+		return true;
+	}
+
+	void FProcessor::ProcessMergedCopies(const PCGExMT::FScope& Scope)
+	{
+		const TConstPCGValueRange<FTransform> InTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+		TPCGValueRange<FTransform> OutTransforms = MergedDataFacade->GetOut()->GetTransformValueRange(false);
+
+		const bool bInheritRotation = Context->TransformDetails.bInheritRotation;
+		const bool bInheritScale = Context->TransformDetails.bInheritScale;
+
+		PCGEX_SCOPE_LOOP(Copy)
+		{
+			const FTransform& TargetTransform = CopyTransforms[Copy];
+			const int32 TargetIndex = CopyTargets[Copy];
+			const int32 Offset = Copy * NumSourcePoints;
+
+			// Same strategies as FTransformPointIO
+			for (int i = 0; i < NumSourcePoints; i++)
+			{
+				const FTransform& InTransform = InTransforms[i];
+				FTransform& OutTransform = OutTransforms[Offset + i];
+
+				if (bInheritRotation && bInheritScale)
+				{
+					OutTransform = InTransform * TargetTransform;
+				}
+				else if (bInheritRotation)
+				{
+					OutTransform = InTransform * TargetTransform;
+					OutTransform.SetRotation(InTransform.GetRotation());
+				}
+				else if (bInheritScale)
+				{
+					OutTransform = InTransform * TargetTransform;
+					OutTransform.SetScale3D(InTransform.GetScale3D());
+				}
+				else
+				{
+					OutTransform = InTransform;
+					OutTransform.SetLocation(TargetTransform.TransformPosition(InTransform.GetLocation()));
+				}
+			}
+
+			if (CopyIndexWriter)
+			{
+				for (int i = 0; i < NumSourcePoints; i++)
+				{
+					CopyIndexWriter->SetValue(Offset + i, TargetIndex);
+				}
+			}
+
+			if (MergedForwardHandler)
+			{
+				for (int i = 0; i < NumSourcePoints; i++)
+				{
+					MergedForwardHandler->Forward(TargetIndex, Offset + i);
+				}
+			}
+		}
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
+		if (bMergeCopies)
+		{
+			ProcessMergedCopies(Scope);
+			return;
+		}
+
 		int32 Copies = 0;
 		FPCGExTaggedData AsCandidate = PointDataFacade->Source->GetTaggedData();
 
@@ -160,6 +348,11 @@ namespace PCGExCopyToPoints
 
 	void FProcessor::CompleteWork()
 	{
+		if (MergedDataFacade && (CopyIndexWriter || MergedForwardHandler))
+		{
+			MergedDataFacade->WriteFastest(TaskManager);
+		}
+
 		if (Settings->DataMatching.bSplitUnmatched && NumCopies == 0)
 		{
 			(void)Context->DataMatcher->HandleUnmatchedOutput(PointDataFacade, true);
@@ -13,6 +13,11 @@
 
 class UPCGExPickerFactoryData;
 
+namespace PCGExPickers
+{
+	class FPickSet;
+}
+
 namespace PCGExData
 {
 	template <typename T>
@@ -175,7 +180,7 @@ namespace PCGExUberFilter
 		FPCGExFilterResultDetails Results = FPCGExFilterResultDetails(false, false);
 
 		bool bUsePicks = false;
-		TSet<int32> Picks;
+		TSharedPtr<const PCGExPickers::FPickSet> Picks;
 
 	public:
 		TSharedPtr<PCGExData::FPointIO> Inside;
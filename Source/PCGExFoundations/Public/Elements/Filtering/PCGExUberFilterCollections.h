@@ -15,6 +15,11 @@
 
 class UPCGExPickerFactoryData;
 
+namespace PCGExPickers
+{
+	class FPickSet;
+}
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="filters/uber-filter-data"))
 class UPCGExUberFilterCollectionsSettings : public UPCGExPointsProcessorSettings
 {
@@ -131,7 +136,7 @@ namespace PCGExUberFilterCollections
 		int32 NumOutside = 0;
 
 		bool bUsePicks = false;
-		TSet<int32> Picks;
+		TSharedPtr<const PCGExPickers::FPickSet> Picks;
 
 	public:
 		TSharedPtr<PCGExData::FPointIO> Inside;
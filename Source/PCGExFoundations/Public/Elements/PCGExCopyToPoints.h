@@ -19,6 +19,12 @@ namespace PCGExMatching
 	class FDataMatcher;
 }
 
+namespace PCGExData
+{
+	template <typename T>
+	class TBuffer;
+}
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="transform/generate/copy-to-points"))
 class UPCGExCopyToPointsSettings : public UPCGExPointsProcessorSettings
 {
@@ -57,7 +63,21 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTransformDetails TransformDetails = FPCGExTransformDetails(true, true);
 
-	/** Target attributes to copy as tags onto output points. */
+	/** If enabled, every copy of an input is written to a single output data instead of one data per target point.
+	 * Much cheaper with many targets. Attribute values are inherited from the input rather than duplicated, and forwarded target attributes are written per point. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	bool bMergeCopies = false;
+
+	/** Write the index of the target point each copied point belongs to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bMergeCopies"))
+	bool bWriteCopyIndex = true;
+
+	/** Name of the attribute to write the target index to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bWriteCopyIndex"))
+	FName CopyIndexAttributeName = FName("CopyIndex");
+
+	/** Target attributes to copy as tags onto output points.
+	 * Ignored when merging copies, since a single merged data cannot carry per-target tags. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding")
 	FPCGExAttributeToTagDetails TargetsAttributesToCopyTags;
 
@@ -102,6 +122,18 @@ namespace PCGExCopyToPoints
 		int32 NumCopies = 0;
 		PCGExMatching::FScope MatchScope;
 
+		// Merged copies
+		bool bMergeCopies = false;
+		int32 NumSourcePoints = 0;
+		TArray<int32> CopyTargets; // Target point index, per copy
+		TArray<FTransform> CopyTransforms;
+		TSharedPtr<PCGExData::FFacade> MergedDataFacade;
+		TSharedPtr<PCGExData::FDataForwardHandler> MergedForwardHandler;
+		TSharedPtr<PCGExData::TBuffer<int32>> CopyIndexWriter;
+
+		bool PrepareMergedCopies();
+		void ProcessMergedCopies(const PCGExMT::FScope& Scope);
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
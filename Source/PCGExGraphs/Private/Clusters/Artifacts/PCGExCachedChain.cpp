@@ -131,22 +131,13 @@ namespace PCGExClusters
 				}
 			}
 
-			// Step 2: Build each chain in parallel
+			// Step 2: Build each chain in parallel; each chain is kept from exactly one of its ends
 			const int32 NumChains = Chains.Num();
-			PCGEX_PARALLEL_FOR(NumChains, Chains[i]->BuildChain(Cluster, nullptr);)
+			FChainClaims Claims(Cluster->Edges->Num());
+			PCGEX_PARALLEL_FOR(NumChains, Chains[i]->BuildChain(Cluster, nullptr, Claims);)
 
-			// Step 3: Deduplicate based on unique hash
-			TSet<uint64> UniqueHashSet;
-			UniqueHashSet.Reserve(NumChains);
-
-			Chains.SetNum(Algo::StableRemoveIf(
-				Chains,
-				[&UniqueHashSet](const TSharedPtr<FNodeChain>& Chain)
-				{
-					bool bAlreadySet = false;
-					UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
-					return bAlreadySet;
-				}));
+			// Step 3: Drop redundant walks, order follows seeds and is stable
+			Chains.SetNum(Algo::StableRemoveIf(Chains, [](const TSharedPtr<FNodeChain>& Chain) { return Chain->bDiscarded; }));
 
 			// Step 4: Create and cache the result
 			TSharedPtr<FCachedChainData> Cached = MakeShared<FCachedChainData>();
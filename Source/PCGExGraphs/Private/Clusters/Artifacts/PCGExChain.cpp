@@ -9,6 +9,36 @@
 
 namespace PCGExClusters
 {
+	FChainClaims::FChainClaims(const int32 NumEdges, const bool bInLeavesOnlySeeds)
+		: bLeavesOnlySeeds(bInLeavesOnlySeeds)
+	{
+		Edges.Init(MAX_int64, NumEdges);
+	}
+
+	bool FChainClaims::Claim(const int32 Edge, const int64 Key)
+	{
+		int64* Slot = &Edges[Edge];
+		int64 Current = FPlatformAtomics::AtomicRead(Slot);
+
+		while (Key < Current)
+		{
+			const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(Slot, Key, Current);
+			if (Previous == Current) { return true; }
+			Current = Previous;
+		}
+
+		return Current == Key;
+	}
+
+	bool FChainClaims::IsSeed(const FCluster* Cluster, const TSharedPtr<TArray<int8>>& Breakpoints, const int32 Node, const int32 Neighbor) const
+	{
+		const FNode* SeedNode = Cluster->GetNode(Node);
+		if (SeedNode->IsLeaf()) { return true; }
+		if (bLeavesOnlySeeds) { return false; }
+		if (SeedNode->IsBinary() && (!Breakpoints || !(*Breakpoints)[SeedNode->PointIndex])) { return false; }
+		return !Cluster->GetNode(Neighbor)->IsLeaf();
+	}
+
 	void FNodeChain::FixUniqueHash()
 	{
 		UniqueHash = 0;
@@ -85,6 +115,76 @@ namespace PCGExClusters
 		}
 	}
 
+	void FNodeChain::BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints, FChainClaims& Claims)
+	{
+		// Same walk as above, except every edge is claimed on the way. The two walks of a chain only ever
+		// compete with each other, so the smaller one never loses a claim and the larger one bails as soon
+		// as it runs into the smaller one's edges.
+
+		const int64 WalkKey = static_cast<int64>(PCGEx::H64(Seed.Node, Seed.Edge));
+		if (!Claims.Claim(Seed.Edge, WalkKey))
+		{
+			bDiscarded = true;
+			return;
+		}
+
+		FLink Last = Seed;
+		FNode* FromNode = Cluster->GetEdgeOtherNode(Seed);
+		Links.Add(FLink(FromNode->Index, Seed.Edge));
+
+		while (FromNode)
+		{
+			if (FromNode->IsLeaf() || FromNode->IsComplex() || (Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
+			{
+				bIsClosedLoop = false;
+				break;
+			}
+
+			FLink NextLink = FromNode->Links[0];
+			if (NextLink.Node == Last.Node)
+			{
+				NextLink = FromNode->Links[1];
+			}
+
+			if (!Claims.Claim(NextLink.Edge, WalkKey))
+			{
+				bDiscarded = true;
+				return;
+			}
+
+			if (NextLink.Node == Seed.Node)
+			{
+				Seed.Edge = NextLink.Edge;
+				bIsClosedLoop = true;
+				break;
+			}
+
+			Last = Links.Last();
+			Links.Add(NextLink);
+
+			FromNode = Cluster->GetNode(NextLink.Node);
+		}
+
+		// The other walk may have finished before this one started; settle it from topology alone.
+		const FLink& End = Links.Last();
+		const int32 BeforeEnd = Links.Num() > 1 ? Links[Links.Num() - 2].Node : Seed.Node;
+
+		const bool bHasMirror = bIsClosedLoop
+			                        ? Claims.IsSeed(&Cluster.Get(), Breakpoints, Seed.Node, End.Node)
+			                        : Claims.IsSeed(&Cluster.Get(), Breakpoints, End.Node, BeforeEnd);
+
+		const int64 MirrorKey = static_cast<int64>(bIsClosedLoop ? PCGEx::H64(Seed.Node, Seed.Edge) : PCGEx::H64(End.Node, End.Edge));
+
+		if (bHasMirror && MirrorKey < WalkKey)
+		{
+			bDiscarded = true;
+			return;
+		}
+
+		bIsLeaf = !bIsClosedLoop && (Cluster->GetNode(Seed.Node)->IsLeaf() || Cluster->GetNode(End.Node)->IsLeaf());
+		FixUniqueHash();
+	}
+
 	FVector FNodeChain::GetFirstEdgeDir(const TSharedPtr<FCluster>& Cluster) const
 	{
 		return Cluster->GetDir(Seed.Node, (*Cluster->NodeIndexLookup)[Cluster->GetEdge(Seed.Edge)->Other(Cluster->GetNodePointIndex(Seed.Node))]);
@@ -224,7 +324,7 @@ namespace PCGExClusters
 				return false;
 			}
 		}
-		return DispatchTasks(TaskManager);
+		return DispatchTasks(TaskManager, false);
 	}
 
 	bool FNodeChainBuilder::CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
@@ -249,23 +349,25 @@ namespace PCGExClusters
 		{
 			return false;
 		}
-		return DispatchTasks(TaskManager);
+		return DispatchTasks(TaskManager, true);
 	}
 
-	bool FNodeChainBuilder::DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
+	bool FNodeChainBuilder::DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const bool bLeavesOnly)
 	{
 		PCGEX_ASYNC_GROUP_CHKD(TaskManager, ChainSearchTask)
 
+		Claims = MakeShared<FChainClaims>(Cluster->Edges->Num(), bLeavesOnly);
+
 		ChainSearchTask->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
 		{
 			PCGEX_ASYNC_THIS
-			This->Dedupe();
+			This->Compact();
 		};
 
 		ChainSearchTask->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
 		{
 			PCGEX_ASYNC_THIS
-			This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints);
+			This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints, *This->Claims);
 		};
 
 		ChainSearchTask->StartIterations(Chains.Num(), 64, false);
@@ -277,19 +379,9 @@ namespace PCGExClusters
 	{
 	}
 
-	void FNodeChainBuilder::Dedupe()
+	void FNodeChainBuilder::Compact()
 	{
-		TSet<uint64> UniqueHashSet;
-		UniqueHashSet.Reserve(Chains.Num());
-
-		Chains.SetNum(Algo::StableRemoveIf(
-			Chains,
-			[&UniqueHashSet](const TSharedPtr<FNodeChain>& Chain)
-			{
-				bool bAlreadySet = false;
-				UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
-				return bAlreadySet; // remove duplicates
-			}
-			));
+		Claims.Reset();
+		Chains.SetNum(Algo::StableRemoveIf(Chains, [](const TSharedPtr<FNodeChain>& Chain) { return Chain->bDiscarded; }));
 	}
 }
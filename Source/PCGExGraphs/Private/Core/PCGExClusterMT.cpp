@@ -7,6 +7,7 @@
 
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterDiskCache.h"
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
 #include "Core/PCGExClusterFilter.h"
@@ -130,7 +131,7 @@ namespace PCGExClusterMT
 			Cluster = MakeShared<PCGExClusters::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
 			Cluster->bIsOneToOne = bIsOneToOne;
 
-			if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+			if (!PCGExClusters::DiskCache::BuildFrom(Cluster.ToSharedRef(), *EndpointsLookup, ExpectedAdjacency))
 			{
 				PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
 				Cluster.Reset();
@@ -5,6 +5,7 @@
 
 #include "PCGExH.h"
 #include "Clusters/PCGExEdge.h"
+#include "Containers/PCGExUnionFind.h"
 #include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExSubGraph.h"
 #include "HAL/PlatformAtomics.h"
@@ -332,37 +333,7 @@ namespace PCGExGraphs
 				NodeValid[i] = Node.bValid;
 			});
 
-		TArray<int32> Parent;
-		Parent.SetNumUninitialized(NumNodes);
-		int32* ParentData = Parent.GetData();
-		PCGExMT::ParallelOrSequential(NumNodes, [&](const int32 i) { ParentData[i] = i; });
-
-		// Iterative find with opportunistic CAS path-halving. Links always attach the
-		// larger root under the smaller one, so parents only ever move toward smaller
-		// indices; a stale relaxed read is just a valid ancestor and the chase
-		// converges regardless of thread interleaving.
-		auto FindRoot = [ParentData](int32 X) -> int32
-		{
-			while (true)
-			{
-				const int32 P = FPlatformAtomics::AtomicRead_Relaxed(ParentData + X);
-				if (P == X)
-				{
-					return X;
-				}
-
-				const int32 GP = FPlatformAtomics::AtomicRead_Relaxed(ParentData + P);
-				if (GP == P)
-				{
-					return P;
-				}
-
-				// Halving is opportunistic; a failed exchange means another thread
-				// already moved this link further along.
-				FPlatformAtomics::InterlockedCompareExchange(ParentData + X, GP, P);
-				X = GP;
-			}
-		};
+		PCGEx::FUnionFind UnionFind(NumNodes);
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(BuildSubGraphs::Union);
@@ -380,46 +351,20 @@ namespace PCGExGraphs
 						return;
 					}
 
-					int32 U = static_cast<int32>(Edge.Start);
-					int32 V = static_cast<int32>(Edge.End);
+					const int32 U = static_cast<int32>(Edge.Start);
+					const int32 V = static_cast<int32>(Edge.End);
 
 					if (!NodeValid[U] || !NodeValid[V])
 					{
 						return;
 					}
 
-					while (true)
-					{
-						U = FindRoot(U);
-						V = FindRoot(V);
-
-						if (U == V)
-						{
-							break;
-						}
-
-						if (U > V)
-						{
-							Swap(U, V);
-						}
-
-						// Attach the larger root under the smaller one; only valid if
-						// V is still its own root, otherwise retry from the new roots.
-						if (FPlatformAtomics::InterlockedCompareExchange(ParentData + V, U, V) == V)
-						{
-							break;
-						}
-					}
+					UnionFind.Union(U, V);
 				});
 
 			// Flatten so every node points directly at its final root; later passes
 			// then resolve components with a single read.
-			PCGExMT::ParallelOrSequential(
-				NumNodes,
-				[&](const int32 i)
-				{
-					FPlatformAtomics::InterlockedExchange(ParentData + i, FindRoot(i));
-				});
+			UnionFind.Flatten();
 		}
 
 		// Assign compact component ids ordered by minimum node index -- the same
@@ -428,10 +373,6 @@ namespace PCGExGraphs
 		int32 TotalExportedNodes = 0;
 
 		TArray<int32> NodeComponent;
-		NodeComponent.Init(-1, NumNodes);
-
-		TArray<int32> RootToComponent;
-		RootToComponent.Init(-1, NumNodes);
 
 		TArray<int32> ComponentNodeCounts;
 		TArray<int32> ComponentEdgeCounts;
@@ -439,44 +380,95 @@ namespace PCGExGraphs
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(BuildSubGraphs::Label);
 
-			for (int32 i = 0; i < NumNodes; i++)
-			{
-				if (!NodeValid[i])
-				{
-					continue;
-				}
-
-				const int32 Root = Parent[i];
-				int32& Component = RootToComponent[Root];
-				if (Component == -1)
-				{
-					Component = NumComponents++;
-					ComponentNodeCounts.Add(0);
-				}
-				NodeComponent[i] = Component;
-				ComponentNodeCounts[Component]++;
-			}
+			// Invalid nodes were never unioned, so masking them out leaves every
+			// valid component intact.
+			NumComponents = UnionFind.Label(NodeComponent, NodeValid);
 
+			ComponentNodeCounts.Init(0, NumComponents);
 			ComponentEdgeCounts.Init(0, NumComponents);
 
-			for (const FEdge& Edge : Edges)
-			{
-				if (!Edge.bValid)
+			int32* NodeCountsData = ComponentNodeCounts.GetData();
+			int32* EdgeCountsData = ComponentEdgeCounts.GetData();
+
+			// Counts are accumulated per run of identical components and flushed on
+			// change: one giant component otherwise serializes every worker on the
+			// same counter.
+			PCGExMT::ParallelOrSequentialScoped(
+				NumNodes,
+				[&](const PCGExMT::FScope& Scope)
 				{
-					continue;
-				}
+					int32 RunComponent = -1;
+					int32 RunCount = 0;
 
-				// Both endpoints share the same component by construction; an edge
-				// with an invalid endpoint belongs to none (mirrors the BFS, which
-				// never collected such edges).
-				const int32 Component = NodeComponent[static_cast<int32>(Edge.Start)];
-				if (Component == -1 || NodeComponent[static_cast<int32>(Edge.End)] == -1)
+					PCGEX_SCOPE_LOOP(i)
+					{
+						const int32 Component = NodeComponent[i];
+						if (Component == -1)
+						{
+							continue;
+						}
+
+						if (Component != RunComponent)
+						{
+							if (RunCount)
+							{
+								FPlatformAtomics::InterlockedAdd(NodeCountsData + RunComponent, RunCount);
+							}
+							RunComponent = Component;
+							RunCount = 0;
+						}
+
+						RunCount++;
+					}
+
+					if (RunCount)
+					{
+						FPlatformAtomics::InterlockedAdd(NodeCountsData + RunComponent, RunCount);
+					}
+				});
+
+			PCGExMT::ParallelOrSequentialScoped(
+				NumEdges,
+				[&](const PCGExMT::FScope& Scope)
 				{
-					continue;
-				}
+					int32 RunComponent = -1;
+					int32 RunCount = 0;
 
-				ComponentEdgeCounts[Component]++;
-			}
+					PCGEX_SCOPE_LOOP(i)
+					{
+						const FEdge& Edge = Edges[i];
+						if (!Edge.bValid)
+						{
+							continue;
+						}
+
+						// Both endpoints share the same component by construction; an edge
+						// with an invalid endpoint belongs to none (mirrors the BFS, which
+						// never collected such edges).
+						const int32 Component = NodeComponent[static_cast<int32>(Edge.Start)];
+						if (Component == -1 || NodeComponent[static_cast<int32>(Edge.End)] == -1)
+						{
+							continue;
+						}
+
+						if (Component != RunComponent)
+						{
+							if (RunCount)
+							{
+								FPlatformAtomics::InterlockedAdd(EdgeCountsData + RunComponent, RunCount);
+							}
+							RunComponent = Component;
+							RunCount = 0;
+						}
+
+						RunCount++;
+					}
+
+					if (RunCount)
+					{
+						FPlatformAtomics::InterlockedAdd(EdgeCountsData + RunComponent, RunCount);
+					}
+				});
 		}
 
 		// Evaluate size limits on counts alone - nothing has been allocated yet.
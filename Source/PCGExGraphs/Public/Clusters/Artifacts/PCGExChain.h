@@ -16,6 +16,26 @@ namespace PCGExClusters
 	class FCluster;
 	using PCGExGraphs::FLink;
 
+	/**
+	 * Shared state for claiming chain walks.
+	 * Every open chain is seeded from both of its ends; instead of walking both and deduping afterward, each walk
+	 * claims the edges it visits with its walk key (seed node, initial edge) and only the smallest key survives.
+	 * The outcome depends on topology alone, so the kept chains and their order don't depend on thread count.
+	 */
+	struct PCGEXGRAPHS_API FChainClaims
+	{
+		TArray<int64> Edges; // Smallest walk key that visited each edge, MAX_int64 when unvisited
+		bool bLeavesOnlySeeds = false;
+
+		explicit FChainClaims(const int32 NumEdges, const bool bInLeavesOnlySeeds = false);
+
+		/** Atomic min. Returns false when a smaller key already owns the edge. */
+		bool Claim(const int32 Edge, const int64 Key);
+
+		/** Whether seeding (see FNodeChainBuilder::Compile) starts a walk from Node along the edge toward Neighbor. */
+		bool IsSeed(const FCluster* Cluster, const TSharedPtr<TArray<int8>>& Breakpoints, const int32 Node, const int32 Neighbor) const;
+	};
+
 	class PCGEXGRAPHS_API FNodeChain : public TSharedFromThis<FNodeChain>
 	{
 	public:
@@ -25,6 +45,8 @@ namespace PCGExClusters
 		bool bIsClosedLoop = false;
 		bool bIsLeaf = false;
 
+		bool bDiscarded = false; // Redundant claiming walk, the same chain is kept from its other end
+
 		uint64 UniqueHash = 0;
 		TArray<FLink> Links; // {Seed} [Edge <- Node][Edge <- Node]
 		// Seed.Edge holds the initial edge from Seed.Node; for closed loops it is overwritten to
@@ -42,6 +64,9 @@ namespace PCGExClusters
 
 		void BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints);
 
+		/** Claiming walk; flags itself bDiscarded when the same chain is owned by a smaller walk. Safe to run concurrently. */
+		void BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints, FChainClaims& Claims);
+
 		FVector GetFirstEdgeDir(const TSharedPtr<FCluster>& Cluster) const;
 		FVector GetLastEdgeDir(const TSharedPtr<FCluster>& Cluster) const;
 		FVector GetEdgeDir(const TSharedPtr<FCluster>& Cluster, const bool bFirst) const;
@@ -59,6 +84,7 @@ namespace PCGExClusters
 	public:
 		TSharedRef<FCluster> Cluster;
 		TSharedPtr<TArray<int8>> Breakpoints;
+		TSharedPtr<FChainClaims> Claims;
 		TArray<TSharedPtr<FNodeChain>> Chains;
 
 		FNodeChainBuilder(const TSharedRef<FCluster>& InCluster);
@@ -67,7 +93,7 @@ namespace PCGExClusters
 		bool CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager);
 
 	protected:
-		bool DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager);
-		void Dedupe();
+		bool DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const bool bLeavesOnly);
+		void Compact();
 	};
 }
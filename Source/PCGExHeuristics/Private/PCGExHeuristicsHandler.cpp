@@ -4,7 +4,10 @@
 #include "PCGExHeuristicsHandler.h"
 
 #include "Clusters/PCGExCluster.h"
+#include "Data/Utils/PCGExDataFingerprint.h"
+#include "Hash/CityHash.h"
 #include "Core/PCGExHeuristicOperation.h"
+#include "Core/PCGExMTCommon.h"
 #include "Heuristics/PCGExHeuristicFeedback.h"
 
 #define PCGEX_INIT_HEURISTIC_OPERATION(_OP, _FACTORY)\
@@ -83,6 +86,8 @@ namespace PCGExHeuristics
 	{
 		for (const UPCGExHeuristicsFactoryData* OperationFactory : InFactories)
 		{
+			ConfigHash = CityHash128to64(Uint128_64(ConfigHash, PCGExFingerprint::ComputeSettings(OperationFactory, UPCGExHeuristicsFactoryData::StaticClass())));
+
 			TSharedPtr<FPCGExHeuristicOperation> Operation = nullptr;
 			bool bIsFeedback = false;
 			if (const UPCGExHeuristicsFactoryFeedback* FeedbackFactory = Cast<UPCGExHeuristicsFactoryFeedback>(OperationFactory))
@@ -149,6 +154,10 @@ namespace PCGExHeuristics
 		DynamicEdgeOps.Reset();
 		BakedStaticEdgeScores.Empty();
 		bHasBakedEdgeScores = false;
+		GoalGlobalOps.Reset();
+		DynamicGlobalOps.Reset();
+		GoalScoreSlots.Empty();
+		GoalScoreTables.Empty();
 
 		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
 		{
@@ -162,6 +171,15 @@ namespace PCGExHeuristics
 			{
 				DynamicEdgeOps.Add(Op.Get());
 			}
+
+			if (Op->HasGoalOnlyGlobalScore())
+			{
+				GoalGlobalOps.Add(Op.Get());
+			}
+			else
+			{
+				DynamicGlobalOps.Add(Op.Get());
+			}
 		}
 	}
 
@@ -202,6 +220,52 @@ namespace PCGExHeuristics
 		bHasBakedEdgeScores = true;
 	}
 
+	void FHandler::BakeGoalScores(const TConstArrayView<int32> InGoalNodes)
+	{
+		// Global scores never apply local weight multipliers, so unlike the edge bake dynamic weights don't
+		// invalidate the tables. Feedback and seed-dependent ops stay in DynamicGlobalOps and are evaluated live.
+		if (GoalGlobalOps.IsEmpty() || !Cluster)
+		{
+			return;
+		}
+
+		const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+		const int32 NumNodes = NodesRef.Num();
+		const int64 TableBytes = static_cast<int64>(NumNodes) * sizeof(double);
+
+		if (GoalScoreSlots.IsEmpty())
+		{
+			GoalScoreSlots.Init(-1, NumNodes);
+		}
+
+		for (const int32 GoalIndex : InGoalNodes)
+		{
+			if (!NodesRef.IsValidIndex(GoalIndex) || GoalScoreSlots[GoalIndex] != -1) { continue; }
+			if ((GoalScoreTables.Num() + 1) * TableBytes > MaxGoalScoreBytes) { break; }
+
+			const PCGExClusters::FNode& Goal = NodesRef[GoalIndex];
+
+			GoalScoreSlots[GoalIndex] = GoalScoreTables.Num();
+			TArray<double>& Table = GoalScoreTables.Emplace_GetRef();
+			Table.SetNumUninitialized(NumNodes);
+
+			PCGExMT::ParallelOrSequential(
+				NumNodes, [&](const int32 i)
+				{
+					const PCGExClusters::FNode& From = NodesRef[i];
+					double Score = BakeIdentity();
+
+					// Goal-only ops ignore Seed by contract; the goal stands in for it.
+					for (const FPCGExHeuristicOperation* Op : GoalGlobalOps)
+					{
+						Score = BakeReduce(Score, BakeContribution(Op->GetGlobalScore(From, Goal, Goal), Op->WeightFactor));
+					}
+
+					Table[i] = Score;
+				});
+		}
+	}
+
 	void FHandler::FeedbackPointScore(const PCGExClusters::FNode& Node)
 	{
 		for (const TSharedPtr<FPCGExHeuristicFeedback>& Op : Feedbacks)
@@ -321,23 +385,35 @@ namespace PCGExHeuristics
 		const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache,
 		const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories)
 	{
+		TSharedPtr<FHandler> Handler;
+
 		switch (ScoreMode)
 		{
 		case EPCGExHeuristicScoreMode::WeightedAverage:
-			return MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::GeometricMean:
-			return MakeShared<FHandlerGeometricMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerGeometricMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::WeightedSum:
-			return MakeShared<FHandlerWeightedSum>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerWeightedSum>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::HarmonicMean:
-			return MakeShared<FHandlerHarmonicMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerHarmonicMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::Min:
-			return MakeShared<FHandlerMin>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerMin>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::Max:
-			return MakeShared<FHandlerMax>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerMax>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		default:
-			return MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			Handler = MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		}
+
+		Handler->ConfigHash = CityHash128to64(Uint128_64(Handler->ConfigHash, static_cast<uint64>(ScoreMode)));
+		return Handler;
 	}
 
 #pragma endregion
@@ -349,9 +425,20 @@ namespace PCGExHeuristics
 		double GScore = 0;
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
 		{
-			GScore += Op->GetGlobalScore(From, Seed, Goal);
+			GScore = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				GScore += Op->GetGlobalScore(From, Seed, Goal);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				GScore += Op->GetGlobalScore(From, Seed, Goal);
+			}
 		}
 		if (LocalFeedback)
 		{
@@ -425,11 +512,23 @@ namespace PCGExHeuristics
 		double WeightedLogSum = 0;
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
+		{
+			WeightedLogSum = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
+				WeightedLogSum += Op->WeightFactor * FMath::Loge(Score / Op->WeightFactor);
+			}
+		}
+		else
 		{
-			const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
-			// Score already includes WeightFactor via ReferenceWeight, so we use WeightFactor for the exponent
-			WeightedLogSum += Op->WeightFactor * FMath::Loge(Score / Op->WeightFactor); // Normalize out the weight from score first
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
+				// Score already includes WeightFactor via ReferenceWeight, so we use WeightFactor for the exponent
+				WeightedLogSum += Op->WeightFactor * FMath::Loge(Score / Op->WeightFactor); // Normalize out the weight from score first
+			}
 		}
 
 		if (LocalFeedback)
@@ -508,9 +607,20 @@ namespace PCGExHeuristics
 	{
 		double GScore = 0;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
 		{
-			GScore += Op->GetGlobalScore(From, Seed, Goal);
+			GScore = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				GScore += Op->GetGlobalScore(From, Seed, Goal);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				GScore += Op->GetGlobalScore(From, Seed, Goal);
+			}
 		}
 		if (LocalFeedback)
 		{
@@ -579,11 +689,23 @@ namespace PCGExHeuristics
 		double WeightedInverseSum = 0;
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
 		{
-			const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
-			// Normalize score by weight first, then compute inverse
-			WeightedInverseSum += Op->WeightFactor / (Score / Op->WeightFactor);
+			WeightedInverseSum = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
+				WeightedInverseSum += Op->WeightFactor / (Score / Op->WeightFactor);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
+				// Normalize score by weight first, then compute inverse
+				WeightedInverseSum += Op->WeightFactor / (Score / Op->WeightFactor);
+			}
 		}
 
 		if (LocalFeedback)
@@ -664,10 +786,22 @@ namespace PCGExHeuristics
 		// Most permissive - any heuristic can allow passage
 		double MinScore = TNumericLimits<double>::Max();
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
 		{
-			const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
-			MinScore = FMath::Min(MinScore, Score);
+			MinScore = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor;
+				MinScore = FMath::Min(MinScore, Score);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
+				MinScore = FMath::Min(MinScore, Score);
+			}
 		}
 
 		if (LocalFeedback && LocalFeedback->TotalStaticWeight > 0)
@@ -743,10 +877,22 @@ namespace PCGExHeuristics
 		// Most restrictive - any heuristic can block passage
 		double MaxScore = TNumericLimits<double>::Lowest();
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		if (const double* GoalScores = GetGoalScores(Goal))
 		{
-			const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
-			MaxScore = FMath::Max(MaxScore, Score);
+			MaxScore = GoalScores[From.Index];
+			for (const FPCGExHeuristicOperation* Op : DynamicGlobalOps)
+			{
+				const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor;
+				MaxScore = FMath::Max(MaxScore, Score);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			{
+				const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
+				MaxScore = FMath::Max(MaxScore, Score);
+			}
 		}
 
 		if (LocalFeedback && LocalFeedback->TotalStaticWeight > 0)
@@ -52,6 +52,13 @@ public:
 		return false;
 	}
 
+	/** True when GetGlobalScore depends only on From/Goal -- no Seed, and no state that mutates between
+	 * queries -- so the handler can tabulate it once per goal. */
+	virtual bool HasGoalOnlyGlobalScore() const
+	{
+		return false;
+	}
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster);
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const;
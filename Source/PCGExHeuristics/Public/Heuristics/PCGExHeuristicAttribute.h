@@ -68,6 +68,12 @@ public:
 		return true;
 	}
 
+	// Uses the constant base global score.
+	virtual bool HasGoalOnlyGlobalScore() const override
+	{
+		return true;
+	}
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
 	virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, PCGEx::FHashLookup* TravelStack = nullptr) const override;
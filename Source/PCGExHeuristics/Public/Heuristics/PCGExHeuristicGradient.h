@@ -69,6 +69,11 @@ public:
 		return true;
 	}
 
+	virtual bool HasGoalOnlyGlobalScore() const override
+	{
+		return true;
+	}
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const override;
@@ -47,6 +47,12 @@ public:
 	int32 MaxSamples = 1;
 	bool bIgnoreIfNotEnoughSamples = true;
 
+	// Inertia only shows in edge scores; the global score is constant.
+	virtual bool HasGoalOnlyGlobalScore() const override
+	{
+		return true;
+	}
+
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const override;
 
 	virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, PCGEx::FHashLookup* TravelStack = nullptr) const override;
@@ -72,6 +72,9 @@ namespace PCGExHeuristics
 		double TotalStaticWeight = 0;
 		bool bUseDynamicWeight = false;
 
+		/** Score mode and settings of every heuristic, identifying equivalent handlers across executions. */
+		uint64 ConfigHash = 0;
+
 		bool IsValidHandler() const
 		{
 			return bIsValidHandler;
@@ -110,6 +113,23 @@ namespace PCGExHeuristics
 			return bHasBakedEdgeScores;
 		}
 
+		/** Tabulates, for each of the given goal nodes, the goal-only portion of global scores for every node of the
+		 * cluster, so GetGlobalScore toward those goals is a lookup plus whatever ops depend on the seed or on
+		 * feedback. Costs one sweep of all nodes x goal-only ops per goal -- only worth it when several queries
+		 * share a goal. Goals past the memory budget, or already tabulated, are skipped.
+		 * Not thread-safe: call from single-threaded prep, before any search. */
+		void BakeGoalScores(TConstArrayView<int32> InGoalNodes);
+
+		FORCEINLINE bool HasGoalScores() const
+		{
+			return !GoalScoreTables.IsEmpty();
+		}
+
+		FORCEINLINE bool CanBakeGoalScores() const
+		{
+			return !GoalGlobalOps.IsEmpty();
+		}
+
 		/** Override in subclasses to implement different score aggregation modes */
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const = 0;
 
@@ -171,8 +191,29 @@ namespace PCGExHeuristics
 			return BakedStaticEdgeScores[(Edge.Index << 1) | (Edge.Start == static_cast<uint32>(From.PointIndex) ? 0 : 1)];
 		}
 
-		// Per-mode hooks driving the static edge-score bake; each must mirror the per-op math
-		// its GetEdgeScore applies to weighted op scores.
+		/** Operations split by HasGoalOnlyGlobalScore, built by CompleteClusterPreparation.
+		 * Raw pointers -- lifetime owned by Operations. */
+		TArray<FPCGExHeuristicOperation*> GoalGlobalOps;
+		TArray<FPCGExHeuristicOperation*> DynamicGlobalOps;
+
+		/** Upper bound on the memory all goal score tables may use, per handler. */
+		static constexpr int64 MaxGoalScoreBytes = 64 << 20;
+
+		/** Per node, index of the table tabulated toward it in GoalScoreTables, -1 if none.
+		 * Tables hold one pre-aggregated value per node, in this mode's accumulation domain. */
+		TArray<int32> GoalScoreSlots;
+		TArray<TArray<double>> GoalScoreTables;
+
+		/** Table of goal-only global scores toward Goal, indexed by node; nullptr when not tabulated. */
+		FORCEINLINE const double* GetGoalScores(const PCGExClusters::FNode& Goal) const
+		{
+			if (GoalScoreSlots.IsEmpty()) { return nullptr; }
+			const int32 Slot = GoalScoreSlots[Goal.Index];
+			return Slot == -1 ? nullptr : GoalScoreTables[Slot].GetData();
+		}
+
+		// Per-mode hooks driving the static edge-score and goal-score bakes; each must mirror the per-op math
+		// its GetEdgeScore and GetGlobalScore apply to weighted op scores.
 
 		/** Transforms a single op's weighted edge score into this mode's accumulation domain */
 		virtual double BakeContribution(const double WeightedScore, const double Weight) const = 0;
@@ -338,11 +338,15 @@ namespace PCGExMatching
 			return true;
 		}
 
+		TBitArray<> Sources;
+		GetIndexedSources(InDataCandidate, InMatchingScope, Sources);
+
 		int32 NumIgnored = 0;
 		TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
-		for (const FPCGExTaggedData& Source : MatchableSourcesRef)
+		for (int32 i = 0; i < NumSources; i++)
 		{
-			if (!Test(Source.Data, InDataCandidate, InMatchingScope))
+			const FPCGExTaggedData& Source = MatchableSourcesRef[i];
+			if (!Sources[i] || !Test(Source.Data, InDataCandidate, InMatchingScope))
 			{
 				OutIgnoreList.Add(Source.Data);
 				NumIgnored++;
@@ -422,8 +426,12 @@ namespace PCGExMatching
 				return OutMatches.Num();
 			}
 
-			for (int32 i = 0; i < NumSources; i++)
+			TBitArray<> Sources;
+			GetIndexedSources(InDataCandidate, InMatchingScope, Sources);
+
+			for (TConstSetBitIterator<> It(Sources); It; ++It)
 			{
+				const int32 i = It.GetIndex();
 				if (InExcludedSources->Contains(i))
 				{
 					continue;
@@ -453,8 +461,11 @@ namespace PCGExMatching
 
 					for (const int32 CurrentIdx : CurrentLevel)
 					{
-						for (int32 i = 0; i < NumSources; i++)
+						GetIndexedSources(MatchableSourcesRef[CurrentIdx], InMatchingScope, Sources);
+
+						for (TConstSetBitIterator<> It(Sources); It; ++It)
 						{
+							const int32 i = It.GetIndex();
 							if (Visited[i] || InExcludedSources->Contains(i))
 							{
 								continue;
@@ -482,8 +493,12 @@ namespace PCGExMatching
 			return OutMatches.Num();
 		}
 
-		for (int32 i = 0; i < NumSources; i++)
+		TBitArray<> Sources;
+		GetIndexedSources(InDataCandidate, InMatchingScope, Sources);
+
+		for (TConstSetBitIterator<> It(Sources); It; ++It)
 		{
+			const int32 i = It.GetIndex();
 			if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope))
 			{
 				OutMatches.Add(i);
@@ -509,8 +524,11 @@ namespace PCGExMatching
 
 				for (const int32 CurrentIdx : CurrentLevel)
 				{
-					for (int32 i = 0; i < NumSources; i++)
+					GetIndexedSources(MatchableSourcesRef[CurrentIdx], InMatchingScope, Sources);
+
+					for (TConstSetBitIterator<> It(Sources); It; ++It)
 					{
+						const int32 i = It.GetIndex();
 						if (Visited[i])
 						{
 							continue;
@@ -553,6 +571,52 @@ namespace PCGExMatching
 		return true;
 	}
 
+	bool FDataMatcher::GetIndexedSources(const FPCGExTaggedData& InDataCandidate, const FScope& InMatchingScope, TBitArray<>& OutSources) const
+	{
+		OutSources.Init(true, NumSources);
+
+		// In Any mode, optional rules can only narrow the query if they're all indexed
+		const bool bAllOptionalIndexed = IndexedOptionalOperations.Num() == OptionalOperations.Num();
+		if (IndexedRequiredOperations.IsEmpty() && (MatchMode == EPCGExMapMatchMode::All ? IndexedOptionalOperations.IsEmpty() : !bAllOptionalIndexed))
+		{
+			return false;
+		}
+
+		TBitArray<> OpSources;
+		auto Intersect = [&](const TSharedPtr<FPCGExMatchRuleOperation>& Op)
+		{
+			OpSources.Init(false, NumSources);
+			Op->GetIndexedSources(InDataCandidate, InMatchingScope, OpSources);
+			OutSources.CombineWithBitwiseAND(OpSources, EBitwiseOperatorFlags::MaintainSize);
+		};
+
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedRequiredOperations)
+		{
+			Intersect(Op);
+		}
+
+		if (MatchMode == EPCGExMapMatchMode::All)
+		{
+			for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedOptionalOperations)
+			{
+				Intersect(Op);
+			}
+		}
+		else if (bAllOptionalIndexed)
+		{
+			TBitArray<> AnySources(false, NumSources);
+			for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedOptionalOperations)
+			{
+				OpSources.Init(false, NumSources);
+				Op->GetIndexedSources(InDataCandidate, InMatchingScope, OpSources);
+				AnySources.CombineWithBitwiseOR(OpSources, EBitwiseOperatorFlags::MaintainSize);
+			}
+			OutSources.CombineWithBitwiseAND(AnySources, EBitwiseOperatorFlags::MaintainSize);
+		}
+
+		return true;
+	}
+
 	int32 FDataMatcher::GetMatchLimitFor(const FPCGExTaggedData& InDataCandidate) const
 	{
 		if (!Details->bSplitUnmatched)
@@ -645,13 +709,22 @@ namespace PCGExMatching
 			}
 			Operations.Add(Operation);
 
+			const bool bIndexed = Operation->SupportsIndexing();
 			if (Factory->BaseConfig.Strictness == EPCGExMatchStrictness::Required)
 			{
 				RequiredOperations.Add(Operation);
+				if (bIndexed)
+				{
+					IndexedRequiredOperations.Add(Operation);
+				}
 			}
 			else
 			{
 				OptionalOperations.Add(Operation);
+				if (bIndexed)
+				{
+					IndexedOptionalOperations.Add(Operation);
+				}
 			}
 
 			if (Operation->WantsRecursion())
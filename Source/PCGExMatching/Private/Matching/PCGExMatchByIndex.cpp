@@ -88,6 +88,21 @@ bool FPCGExMatchByIndex::Test(const PCGExData::FConstPoint& InTargetElement, con
 	return Config.bInvert ? !bResult : bResult;
 }
 
+void FPCGExMatchByIndex::GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const
+{
+	int32 IndexValue = -1;
+	if (!PCGExData::Helpers::TryReadDataValue<int32>(Context, InCandidate.Data, Config.IndexAttribute, IndexValue))
+	{
+		return;
+	}
+
+	IndexValue = PCGExMath::SanitizeIndex(IndexValue, MatchableSources->Num() - 1, Config.IndexSafety);
+	if (OutSources.IsValidIndex(IndexValue))
+	{
+		OutSources[IndexValue] = true;
+	}
+}
+
 bool UPCGExMatchByIndexFactory::WantsPoints()
 {
 	return !PCGExMetaHelpers::IsDataDomainAttribute(Config.IndexAttribute);
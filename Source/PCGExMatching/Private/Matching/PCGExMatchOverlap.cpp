@@ -123,6 +123,32 @@ void FPCGExMatchOverlap::GetOverlappingSourceIndices(const FBox& CandidateBounds
 		});
 }
 
+void FPCGExMatchOverlap::GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const
+{
+	const UPCGSpatialData* CandidateSpatialData = Cast<UPCGSpatialData>(InCandidate.Data);
+	if (!CandidateSpatialData)
+	{
+		return;
+	}
+
+	const FBox CandidateBounds = CandidateSpatialData->GetBounds();
+	if (!CandidateBounds.IsValid)
+	{
+		// Let Test decide
+		OutSources.SetRange(0, OutSources.Num(), true);
+		return;
+	}
+
+	// Slightly expanded so touching boxes are still flagged, Test has the final say
+	TArray<int32> Overlapping;
+	GetOverlappingSourceIndices(CandidateBounds.ExpandBy(UE_KINDA_SMALL_NUMBER), Overlapping);
+
+	for (const int32 i : Overlapping)
+	{
+		OutSources[i] = true;
+	}
+}
+
 double FPCGExMatchOverlap::ComputeOverlapRatio(const FBox& BoxA, const FBox& BoxB)
 {
 	const FBox Intersection = BoxA.Overlap(BoxB);
@@ -55,9 +55,134 @@ bool FPCGExMatchSharedTag::PrepareForMatchableSources(FPCGExContext* InContext,
 		}
 	}
 
+	if (Config.bInvert)
+	{
+		return true;
+	}
+
+	for (int32 i = 0; i < MatchableSourcesRef.Num(); i++)
+	{
+		const TSharedPtr<PCGExData::FTags> SourceTags = MatchableSourcesRef[i].GetTags();
+		if (!SourceTags)
+		{
+			continue;
+		}
+
+		if (Config.Mode == EPCGExTagMatchMode::Specific)
+		{
+			// Same data-level read as Test
+			FString TestTagName = TagNameGetters.IsEmpty() ? Config.TagName : TagNameGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), TEXT(""));
+			PCGExData::TryGetValueFromTag(TestTagName, TestTagName);
+
+			if (SourceTags->RawTags.Contains(TestTagName) || SourceTags->ValueTags.Contains(TestTagName))
+			{
+				TagIndex.FindOrAdd(TestTagName).Add(i);
+			}
+
+			continue;
+		}
+
+		for (const FString& Tag : SourceTags->RawTags)
+		{
+			TagIndex.FindOrAdd(Tag).Add(i);
+		}
+
+		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : SourceTags->ValueTags)
+		{
+			TagIndex.FindOrAdd(Pair.Key).Add(i);
+		}
+	}
+
+	bIndexed = true;
 	return true;
 }
 
+void FPCGExMatchSharedTag::GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const
+{
+	const TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags();
+	if (!CandidateTags)
+	{
+		return;
+	}
+
+	if (Config.Mode == EPCGExTagMatchMode::AllShared)
+	{
+		if (CandidateTags->RawTags.IsEmpty() && CandidateTags->ValueTags.IsEmpty())
+		{
+			// Empty candidate tags always match
+			for (int32 i = 0; i < OutSources.Num(); i++)
+			{
+				if (Tags[i].IsValid())
+				{
+					OutSources[i] = true;
+				}
+			}
+			return;
+		}
+
+		// Sources must carry every candidate tag; the rarest one is enough to narrow them down
+		const TArray<int32>* Rarest = nullptr;
+		auto Narrow = [&](const FString& Tag)
+		{
+			const TArray<int32>* TagSources = TagIndex.Find(Tag);
+			if (!TagSources)
+			{
+				return false;
+			}
+			if (!Rarest || TagSources->Num() < Rarest->Num())
+			{
+				Rarest = TagSources;
+			}
+			return true;
+		};
+
+		for (const FString& Tag : CandidateTags->RawTags)
+		{
+			if (!Narrow(Tag))
+			{
+				return;
+			}
+		}
+
+		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+		{
+			if (!Narrow(Pair.Key))
+			{
+				return;
+			}
+		}
+
+		for (const int32 i : *Rarest)
+		{
+			OutSources[i] = true;
+		}
+
+		return;
+	}
+
+	// Specific & AnyShared : at least one tag name must be shared
+	auto Flag = [&](const FString& Tag)
+	{
+		if (const TArray<int32>* TagSources = TagIndex.Find(Tag))
+		{
+			for (const int32 i : *TagSources)
+			{
+				OutSources[i] = true;
+			}
+		}
+	};
+
+	for (const FString& Tag : CandidateTags->RawTags)
+	{
+		Flag(Tag);
+	}
+
+	for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+	{
+		Flag(Pair.Key);
+	}
+}
+
 bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const
 {
 	TSharedPtr<PCGExData::FTags> TargetTags = Tags[InTargetElement.IO].Pin();
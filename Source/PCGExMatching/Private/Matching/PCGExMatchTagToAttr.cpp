@@ -4,6 +4,7 @@
 #include "Matching/PCGExMatchTagToAttr.h"
 
 #include "Data/PCGExAttributeBroadcaster.h"
+#include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Factories/PCGExFactoryData.h"
 
@@ -44,6 +45,16 @@ bool FPCGExMatchTagToAttr::PrepareForMatchableSources(FPCGExContext* InContext,
 
 			TagNameGetters.Add(Getter);
 		}
+
+		if (!Config.bInvert && Config.NameMatch == EPCGExStringMatchMode::Equals)
+		{
+			// Same data-level read as Test
+			for (int32 i = 0; i < TagNameGetters.Num(); i++)
+			{
+				TagNameIndex.FindOrAdd(TagNameGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), TEXT(""))).Add(i);
+			}
+			bIndexed = true;
+		}
 	}
 
 	if (!Config.bDoValueMatch)
@@ -130,6 +141,36 @@ bool FPCGExMatchTagToAttr::Test(const PCGExData::FConstPoint& InTargetElement, c
 	return !Config.bInvert;
 }
 
+void FPCGExMatchTagToAttr::GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const
+{
+	const TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags();
+	if (!CandidateTags)
+	{
+		return;
+	}
+
+	auto Flag = [&](const FString& Tag)
+	{
+		if (const TArray<int32>* TagSources = TagNameIndex.Find(Tag))
+		{
+			for (const int32 i : *TagSources)
+			{
+				OutSources[i] = true;
+			}
+		}
+	};
+
+	for (const FString& Tag : CandidateTags->RawTags)
+	{
+		Flag(Tag);
+	}
+
+	for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+	{
+		Flag(Pair.Key);
+	}
+}
+
 bool UPCGExMatchTagToAttrFactory::WantsPoints()
 {
 	if (Config.TagNameInput == EPCGExInputValueType::Attribute && !PCGExMetaHelpers::IsDataDomainAttribute(Config.TagNameAttribute))
@@ -86,6 +86,19 @@ public:
 		return -1;
 	}
 
+	/** Whether this rule built an index over the matchable sources, see GetIndexedSources. Inverted rules can't be indexed. */
+	virtual bool SupportsIndexing() const
+	{
+		return false;
+	}
+
+	/** Flags the matchable sources the candidate may pass this rule against, using the index built during preparation.
+	 *  Data-level only. Must flag a superset of what Test accepts; flagged sources are still tested.
+	 *  OutSources is sized to the number of matchable sources and cleared. */
+	virtual void GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const
+	{
+	}
+
 protected:
 	TSharedPtr<TArray<FPCGExTaggedData>> MatchableSources;
 };
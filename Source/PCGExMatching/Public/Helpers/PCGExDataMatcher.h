@@ -71,6 +71,10 @@ namespace PCGExMatching
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> RequiredOperations;
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> OptionalOperations;
 
+		// Subsets of the above that can narrow down data-level queries through their source index
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> IndexedRequiredOperations;
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> IndexedOptionalOperations;
+
 	public:
 		EPCGExMapMatchMode MatchMode = EPCGExMapMatchMode::Disabled;
 
@@ -148,6 +152,10 @@ namespace PCGExMatching
 		}
 
 	protected:
+		/** Flags the sources InDataCandidate may match according to the indexed rules, all of them if none can narrow the query.
+		 *  Flagged sources still need to go through Test. Returns false if nothing was narrowed down. */
+		bool GetIndexedSources(const FPCGExTaggedData& InDataCandidate, const FScope& InMatchingScope, TBitArray<>& OutSources) const;
+
 		int32 GetMatchLimitFor(const FPCGExTaggedData& InDataCandidate) const;
 		void RegisterTaggedData(FPCGExContext* InContext, const FPCGExTaggedData& InTaggedData);
 		bool InitInternal(FPCGExContext* InContext, const FName InFactoriesLabel);
@@ -58,6 +58,14 @@ public:
 	virtual bool PrepareForMatchableSources(FPCGExContext* InContext, const TSharedPtr<TArray<FPCGExTaggedData>>& InMatchableSources) override;
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	/** Candidate mode reads a single source index on the candidate, which is a direct lookup. */
+	virtual bool SupportsIndexing() const override
+	{
+		return !Config.bInvert && Config.Source == EPCGExMatchByIndexSource::Candidate;
+	}
+
+	virtual void GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<int32>>> IndexGetters;
 	bool bIsIndex = false;
@@ -90,6 +90,13 @@ public:
 		return Config.MaxRecursionDepth;
 	}
 
+	virtual bool SupportsIndexing() const override
+	{
+		return !Config.bInvert;
+	}
+
+	virtual void GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const override;
+
 protected:
 	// Pre-computed source bounds (already expanded during preparation)
 	TArray<FBox> SourceBounds;
@@ -73,9 +73,20 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	virtual bool SupportsIndexing() const override
+	{
+		return bIndexed;
+	}
+
+	virtual void GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> TagNameGetters;
 	TArray<TWeakPtr<PCGExData::FTags>> Tags;
+
+	// Tag name (raw or value key) -> sources carrying it. In Specific mode, only the tested tag of each source is indexed.
+	TMap<FString, TArray<int32>> TagIndex;
+	bool bIndexed = false;
 };
 
 
@@ -81,10 +81,21 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	virtual bool SupportsIndexing() const override
+	{
+		return bIndexed;
+	}
+
+	virtual void GetIndexedSources(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, TBitArray<>& OutSources) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> TagNameGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<double>>> NumGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> StrGetters;
+
+	// Tag name read on each source -> sources. Only built for per-source tag names with an exact name match.
+	TMap<FString, TArray<int32>> TagNameIndex;
+	bool bIndexed = false;
 };
 
 
@@ -0,0 +1,60 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExPickSet.h"
+
+namespace PCGExPickers
+{
+	FPickSet::FPickSet(const int32 InNum)
+	{
+		Bits.Init(false, FMath::Max(0, InNum));
+	}
+
+	void FPickSet::Add(const int32 Index)
+	{
+		if (!Bits.IsValidIndex(Index) || Bits[Index])
+		{
+			return;
+		}
+
+		Bits[Index] = true;
+		NumPicks++;
+	}
+
+	void FPickSet::AddRange(int32 Start, int32 End)
+	{
+		Start = FMath::Max(Start, 0);
+		End = FMath::Min(End, Bits.Num() - 1);
+		if (Start > End)
+		{
+			return;
+		}
+
+		Bits.SetRange(Start, End - Start + 1, true);
+		NumPicks = Bits.CountSetBits();
+	}
+
+	void FPickSet::Union(const FPickSet& Other)
+	{
+		check(Other.GetNum() == GetNum());
+		Bits.CombineWithBitwiseOR(Other.Bits, EBitwiseOperatorFlags::MaintainSize);
+		NumPicks = Bits.CountSetBits();
+	}
+
+	void FPickSet::Intersect(const FPickSet& Other)
+	{
+		check(Other.GetNum() == GetNum());
+		Bits.CombineWithBitwiseAND(Other.Bits, EBitwiseOperatorFlags::MaintainSize);
+		NumPicks = Bits.CountSetBits();
+	}
+
+	int32 FPickSet::First() const
+	{
+		return Bits.Find(true);
+	}
+
+	int32 FPickSet::Last() const
+	{
+		return Bits.FindLast(true);
+	}
+}
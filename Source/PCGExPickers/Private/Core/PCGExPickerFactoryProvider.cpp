@@ -10,12 +10,56 @@
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoPicker, UPCGExPickerFactoryData)
 
-void UPCGExPickerFactoryData::AddPicks(const int32 InNum, TSet<int32>& OutPicks) const
+namespace PCGExPickers
+{
+	// Distinct data sizes a single factory is expected to see; past that the cache is flushed.
+	constexpr int32 MaxCachedPickSets = 32;
+}
+
+void UPCGExPickerFactoryData::AddPicks(const int32 InNum, PCGExPickers::FPickSet& OutPicks) const
 {
 }
 
+TSharedPtr<const PCGExPickers::FPickSet> UPCGExPickerFactoryData::GetPicks(const int32 InNum) const
+{
+	{
+		FReadScopeLock ReadScopeLock(PicksCacheLock);
+		if (const TSharedPtr<const PCGExPickers::FPickSet>* Cached = PicksCache.Find(InNum))
+		{
+			return *Cached;
+		}
+	}
+
+	// Resolve outside the lock; if another thread got there first, keep theirs.
+	TSharedPtr<PCGExPickers::FPickSet> NewPicks = MakeShared<PCGExPickers::FPickSet>(InNum);
+	AddPicks(InNum, *NewPicks);
+
+	{
+		FWriteScopeLock WriteScopeLock(PicksCacheLock);
+		if (const TSharedPtr<const PCGExPickers::FPickSet>* Cached = PicksCache.Find(InNum))
+		{
+			return *Cached;
+		}
+
+		if (PicksCache.Num() >= PCGExPickers::MaxCachedPickSets)
+		{
+			PicksCache.Reset();
+		}
+
+		PicksCache.Add(InNum, NewPicks);
+	}
+
+	return NewPicks;
+}
+
 PCGExFactories::EPreparationResult UPCGExPickerFactoryData::Prepare(FPCGExContext* InContext, const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
 {
+	{
+		// Internal data is about to be rebuilt
+		FWriteScopeLock WriteScopeLock(PicksCacheLock);
+		PicksCache.Reset();
+	}
+
 	PCGExFactories::EPreparationResult Result = Super::Prepare(InContext, TaskManager);
 	if (Result != PCGExFactories::EPreparationResult::Success)
 	{
@@ -47,19 +91,29 @@ UPCGExFactoryData* UPCGExPickerFactoryProviderSettings::CreateFactory(FPCGExCont
 
 namespace PCGExPickers
 {
-	bool GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const TSharedPtr<PCGExData::FFacade>& InFacade, TSet<int32>& OutPicks)
+	TSharedPtr<const FPickSet> GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const int32 InNum)
 	{
 		if (Factories.IsEmpty())
 		{
-			return false;
+			return nullptr;
+		}
+
+		if (Factories.Num() == 1)
+		{
+			return Factories[0]->GetPicks(InNum);
 		}
 
-		const int32 Num = InFacade->GetNum();
-		for (const TObjectPtr<const UPCGExPickerFactoryData>& Op : Factories)
+		TSharedPtr<FPickSet> Picks = MakeShared<FPickSet>(*Factories[0]->GetPicks(InNum));
+		for (int32 i = 1; i < Factories.Num(); i++)
 		{
-			Op->AddPicks(Num, OutPicks);
+			Picks->Union(*Factories[i]->GetPicks(InNum));
 		}
-		return true;
+		return Picks;
+	}
+
+	TSharedPtr<const FPickSet> GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const TSharedPtr<PCGExData::FFacade>& InFacade)
+	{
+		return GetPicks(Factories, InFacade->GetNum());
 	}
 }
 
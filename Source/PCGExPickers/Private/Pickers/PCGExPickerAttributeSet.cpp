@@ -31,14 +31,13 @@ FString UPCGExPickerAttributeSetSettings::GetDisplayName() const
 }
 #endif
 
-void UPCGExPickerAttributeSetFactory::AddPicks(const int32 InNum, TSet<int32>& OutPicks) const
+void UPCGExPickerAttributeSetFactory::AddPicks(const int32 InNum, PCGExPickers::FPickSet& OutPicks) const
 {
 	int32 TargetIndex = 0;
 	const int32 MaxIndex = InNum - 1;
 
 	if (Config.bTreatAsNormalized)
 	{
-		OutPicks.Reserve(OutPicks.Num() + RelativePicks.Num());
 		for (const double Pick : RelativePicks)
 		{
 			TargetIndex = PCGExMath::TruncateDbl(static_cast<double>(MaxIndex) * Pick, Config.TruncateMode);
@@ -57,7 +56,6 @@ void UPCGExPickerAttributeSetFactory::AddPicks(const int32 InNum, TSet<int32>& O
 	}
 	else
 	{
-		OutPicks.Reserve(OutPicks.Num() + DiscretePicks.Num());
 		for (const int32 Pick : DiscretePicks)
 		{
 			TargetIndex = Pick;
@@ -99,7 +99,7 @@ bool UPCGExPickerAttributeSetRangesFactory::GetUniqueRanges(FPCGExContext* InCon
 	return true;
 }
 
-void UPCGExPickerAttributeSetRangesFactory::AddPicks(const int32 InNum, TSet<int32>& OutPicks) const
+void UPCGExPickerAttributeSetRangesFactory::AddPicks(const int32 InNum, PCGExPickers::FPickSet& OutPicks) const
 {
 	for (const FPCGExPickerConstantRangeConfig& RangeConfig : Ranges)
 	{
@@ -29,7 +29,7 @@ FString UPCGExPickerConstantSettings::GetDisplayName() const
 }
 #endif
 
-void UPCGExPickerConstantFactory::AddPicks(const int32 InNum, TSet<int32>& OutPicks) const
+void UPCGExPickerConstantFactory::AddPicks(const int32 InNum, PCGExPickers::FPickSet& OutPicks) const
 {
 	int32 TargetIndex = 0;
 	const int32 MaxIndex = InNum - 1;
@@ -57,7 +57,7 @@ bool FPCGExPickerConstantRangeConfig::IsWithinInclusive(const double Value) cons
 	return FMath::IsWithinInclusive(Value, RelativeStartIndex, RelativeEndIndex);
 }
 
-void UPCGExPickerConstantRangeFactory::AddPicksFromConfig(const FPCGExPickerConstantRangeConfig& InConfig, int32 InNum, TSet<int32>& OutPicks)
+void UPCGExPickerConstantRangeFactory::AddPicksFromConfig(const FPCGExPickerConstantRangeConfig& InConfig, int32 InNum, PCGExPickers::FPickSet& OutPicks)
 {
 	int32 TargetStartIndex = 0;
 	int32 TargetEndIndex = 0;
@@ -91,14 +91,10 @@ void UPCGExPickerConstantRangeFactory::AddPicksFromConfig(const FPCGExPickerCons
 		return;
 	}
 
-	OutPicks.Reserve(OutPicks.Num() + TargetEndIndex - TargetStartIndex + 1);
-	for (int i = TargetStartIndex; i <= TargetEndIndex; i++)
-	{
-		OutPicks.Add(i);
-	}
+	OutPicks.AddRange(TargetStartIndex, TargetEndIndex);
 }
 
-void UPCGExPickerConstantRangeFactory::AddPicks(const int32 InNum, TSet<int32>& OutPicks) const
+void UPCGExPickerConstantRangeFactory::AddPicks(const int32 InNum, PCGExPickers::FPickSet& OutPicks) const
 {
 	AddPicksFromConfig(Config, InNum, OutPicks);
 }
@@ -0,0 +1,69 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExPickers
+{
+	/**
+	 * Resolved picks for a given data size, stored as one bit per index.
+	 * Membership is a single bit lookup; unions and intersections run word-wide.
+	 * Sets handed out by a picker factory are shared and immutable -- combine into a copy.
+	 */
+	class PCGEXPICKERS_API FPickSet
+	{
+	public:
+		FPickSet() = default;
+		explicit FPickSet(const int32 InNum);
+
+		/** Size of the data the picks were resolved against. */
+		FORCEINLINE int32 GetNum() const
+		{
+			return Bits.Num();
+		}
+
+		FORCEINLINE int32 NumPicked() const
+		{
+			return NumPicks;
+		}
+
+		FORCEINLINE bool IsEmpty() const
+		{
+			return NumPicks == 0;
+		}
+
+		FORCEINLINE bool Contains(const int32 Index) const
+		{
+			return Bits.IsValidIndex(Index) && Bits[Index];
+		}
+
+		/** Out-of-range indices are ignored. */
+		void Add(const int32 Index);
+
+		/** Inclusive range, clamped to the data size. */
+		void AddRange(int32 Start, int32 End);
+
+		void Union(const FPickSet& Other);
+		void Intersect(const FPickSet& Other);
+
+		/** Lowest/highest picked index, INDEX_NONE if empty. */
+		int32 First() const;
+		int32 Last() const;
+
+		/** Picked indices, ascending. */
+		template <typename FnT>
+		void ForEach(FnT&& Fn) const
+		{
+			for (TConstSetBitIterator<> It(Bits); It; ++It)
+			{
+				Fn(It.GetIndex());
+			}
+		}
+
+	private:
+		TBitArray<> Bits;
+		int32 NumPicks = 0;
+	};
+}
@@ -7,6 +7,7 @@
 #include "Factories/PCGExFactoryProvider.h"
 
 #include "PCGExPickersCommon.h"
+#include "Core/PCGExPickSet.h"
 #include "Factories/PCGExFactoryData.h"
 #include "Math/PCGExMath.h"
 
@@ -86,7 +87,13 @@ public:
 		return PCGExFactories::EType::IndexPicker;
 	}
 
-	virtual void AddPicks(int32 InNum, TSet<int32>& OutPicks) const;
+	virtual void AddPicks(int32 InNum, PCGExPickers::FPickSet& OutPicks) const;
+
+	/**
+	 * Picks resolved against a data of size InNum. Resolved once per size and shared
+	 * by every consumer of this factory, so don't modify the returned set.
+	 */
+	TSharedPtr<const PCGExPickers::FPickSet> GetPicks(int32 InNum) const;
 
 	FPCGExPickerConfigBase BaseConfig;
 	virtual PCGExFactories::EPreparationResult Prepare(FPCGExContext* InContext, const TSharedPtr<PCGExMT::FTaskManager>& TaskManager) override;
@@ -100,6 +107,9 @@ protected:
 	}
 
 	virtual PCGExFactories::EPreparationResult InitInternalData(FPCGExContext* InContext);
+
+	mutable FRWLock PicksCacheLock;
+	mutable TMap<int32, TSharedPtr<const PCGExPickers::FPickSet>> PicksCache;
 };
 
 UCLASS(Abstract, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph|Params")
@@ -136,6 +146,13 @@ public:
 
 namespace PCGExPickers
 {
+	/**
+	 * Union of the factories' picks for the given data. A single factory returns its cached set as-is;
+	 * returns nullptr if there are no factories.
+	 */
+	PCGEXPICKERS_API
+	TSharedPtr<const FPickSet> GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const int32 InNum);
+
 	PCGEXPICKERS_API
-	bool GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const TSharedPtr<PCGExData::FFacade>& InFacade, TSet<int32>& OutPicks);
+	TSharedPtr<const FPickSet> GetPicks(const TArray<TObjectPtr<const UPCGExPickerFactoryData>>& Factories, const TSharedPtr<PCGExData::FFacade>& InFacade);
 }
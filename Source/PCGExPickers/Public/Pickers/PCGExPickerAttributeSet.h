@@ -37,7 +37,7 @@ public:
 		return true;
 	}
 
-	virtual void AddPicks(int32 InNum, TSet<int32>& OutPicks) const override;
+	virtual void AddPicks(int32 InNum, PCGExPickers::FPickSet& OutPicks) const override;
 
 protected:
 	virtual PCGExFactories::EPreparationResult InitInternalData(FPCGExContext* InContext) override;
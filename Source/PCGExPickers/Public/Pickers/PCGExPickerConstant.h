@@ -36,7 +36,7 @@ public:
 	UPROPERTY()
 	FPCGExPickerConstantConfig Config;
 
-	virtual void AddPicks(int32 InNum, TSet<int32>& OutPicks) const override;
+	virtual void AddPicks(int32 InNum, PCGExPickers::FPickSet& OutPicks) const override;
 };
 
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Pickers|Params", meta=(PCGExNodeLibraryDoc="utilities/pickers/picker-constant"))
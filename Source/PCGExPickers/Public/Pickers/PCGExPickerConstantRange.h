@@ -49,8 +49,8 @@ public:
 	UPROPERTY()
 	FPCGExPickerConstantRangeConfig Config;
 
-	static void AddPicksFromConfig(const FPCGExPickerConstantRangeConfig& InConfig, int32 InNum, TSet<int32>& OutPicks);
-	virtual void AddPicks(int32 InNum, TSet<int32>& OutPicks) const override;
+	static void AddPicksFromConfig(const FPCGExPickerConstantRangeConfig& InConfig, int32 InNum, PCGExPickers::FPickSet& OutPicks);
+	virtual void AddPicks(int32 InNum, PCGExPickers::FPickSet& OutPicks) const override;
 };
 
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Pickers|Params")
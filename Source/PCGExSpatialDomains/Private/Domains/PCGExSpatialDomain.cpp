@@ -15,14 +15,33 @@ float FPCGExSpatialDomain::QueryOBB(const PCGExMath::OBB::FOBB& Bounds) const
 	// Default: sample center + 8 corners, return minimum (most "inside").
 	// Conservative for MustBeOutside; MustBeInside callers also need the max,
 	// so they sample corners themselves rather than going through QueryOBB.
-	float MinDist = QueryPoint(Bounds.GetOrigin());
+	TArray<FVector, TInlineAllocator<9>> Samples;
+	Samples.Add(Bounds.GetOrigin());
 	Bounds.ForEachCorner([&](const FVector& World)
 	{
-		MinDist = FMath::Min(MinDist, QueryPoint(World));
+		Samples.Add(World);
 	});
+
+	float Distances[9];
+	QueryPoints(Samples, TArrayView<float>(Distances, Samples.Num()));
+
+	float MinDist = Distances[0];
+	for (int32 i = 1; i < Samples.Num(); i++)
+	{
+		MinDist = FMath::Min(MinDist, Distances[i]);
+	}
 	return MinDist;
 }
 
+void FPCGExSpatialDomain::QueryPoints(TConstArrayView<FVector> Points, TArrayView<float> OutDistances) const
+{
+	check(OutDistances.Num() >= Points.Num());
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		OutDistances[i] = QueryPoint(Points[i]);
+	}
+}
+
 bool FPCGExSpatialDomain::Overlaps(
 	const FPCGExFootprintShape& Candidate,
 	[[maybe_unused]] int32 SkipOwnerIndex,
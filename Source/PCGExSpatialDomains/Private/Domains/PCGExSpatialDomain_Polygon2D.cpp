@@ -6,6 +6,12 @@
 #include "Math/Geo/PCGExGeo.h"
 #include "Paths/PCGExPolyPath.h"
 
+namespace PCGExSpatialDomainPolygon2D
+{
+	// Caps grid memory for very elongated outlines; cells grow instead.
+	constexpr int32 MaxGridCellsPerAxis = 1024;
+}
+
 FPCGExSpatialDomain_Polygon2D FPCGExSpatialDomain_Polygon2D::MakeFromOutline(
 	TArray<FVector2D> InOutline,
 	float InZMin,
@@ -43,10 +49,149 @@ float FPCGExSpatialDomain_Polygon2D::QueryPoint(const FVector& Point) const
 {
 	// No WorldOrigin: outline is already in projection-frame XY, so only the
 	// quaternion unrotation is needed to bring the world point into local space.
-	return PCGExMath::Geo::SignedDistanceToPolygonPrism(
-		ProjectionQuat.UnrotateVector(Point),
-		TConstArrayView<FVector2D>(Outline),
-		ZMin, ZMax);
+	return QueryLocalPoint(ProjectionQuat.UnrotateVector(Point));
+}
+
+void FPCGExSpatialDomain_Polygon2D::QueryPoints(TConstArrayView<FVector> Points, TArrayView<float> OutDistances) const
+{
+	check(OutDistances.Num() >= Points.Num());
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		OutDistances[i] = QueryLocalPoint(ProjectionQuat.UnrotateVector(Points[i]));
+	}
+}
+
+float FPCGExSpatialDomain_Polygon2D::QueryLocalPoint(const FVector& LocalPoint) const
+{
+	if (!HasEdgeGrid())
+	{
+		return PCGExMath::Geo::SignedDistanceToPolygonPrism(LocalPoint, TConstArrayView<FVector2D>(Outline), ZMin, ZMax);
+	}
+
+	const FVector2D P2D(LocalPoint.X, LocalPoint.Y);
+	return PCGExMath::Geo::CombinePolygonPrismDistance(IsInside2D(P2D), ClosestEdgeDistSquared(P2D), LocalPoint.Z, ZMin, ZMax);
+}
+
+bool FPCGExSpatialDomain_Polygon2D::IsInside2D(const FVector2D& P) const
+{
+	if (P.X < Bounds2D.Min.X || P.X > Bounds2D.Max.X || P.Y < Bounds2D.Min.Y || P.Y > Bounds2D.Max.Y)
+	{
+		return false;
+	}
+
+	// Only edges whose Y span covers P.Y can contribute to the winding number,
+	// and all of them are listed in P's row. Same test as the O(N) pass.
+	const int32 N = Outline.Num();
+	const int32 Row = GetCellY(P.Y);
+
+	int32 Winding = 0;
+	for (int32 k = RowStarts[Row]; k < RowStarts[Row + 1]; k++)
+	{
+		const int32 Edge = RowEdges[k];
+		const FVector2D& A = Outline[Edge];
+		const FVector2D& B = Outline[Edge + 1 == N ? 0 : Edge + 1];
+		const float Cross = (B.X - A.X) * (P.Y - A.Y) - (B.Y - A.Y) * (P.X - A.X);
+		if (A.Y <= P.Y && B.Y > P.Y && Cross > 0.0f)
+		{
+			++Winding;
+		}
+		else if (A.Y > P.Y && B.Y <= P.Y && Cross < 0.0f)
+		{
+			--Winding;
+		}
+	}
+
+	return Winding != 0;
+}
+
+float FPCGExSpatialDomain_Polygon2D::ClosestEdgeDistSquared(const FVector2D& P) const
+{
+	const int32 N = Outline.Num();
+	const int32 CX = GetCellX(P.X);
+	const int32 CY = GetCellY(P.Y);
+
+	float MinDistSq = TNumericLimits<float>::Max();
+
+	auto VisitRowSpan = [&](const int32 Y, const int32 X0, const int32 X1)
+	{
+		if (Y < 0 || Y >= GridCellsY)
+		{
+			return;
+		}
+
+		const int32 RowOffset = Y * GridCellsX;
+		for (int32 X = FMath::Max(X0, 0); X <= FMath::Min(X1, GridCellsX - 1); X++)
+		{
+			const int32 Cell = RowOffset + X;
+			for (int32 k = CellStarts[Cell]; k < CellStarts[Cell + 1]; k++)
+			{
+				const int32 Edge = CellEdges[k];
+				MinDistSq = FMath::Min(MinDistSq, PCGExMath::Geo::DistancePointToSegmentSquared2D(P, Outline[Edge], Outline[Edge + 1 == N ? 0 : Edge + 1]));
+			}
+		}
+	};
+
+	const FVector2D GridMax = GridOrigin + FVector2D(static_cast<double>(GridCellsX), static_cast<double>(GridCellsY)) * GridCellSize;
+	auto DistSquaredToRegion = [&](const double MinX, const double MinY, const double MaxX, const double MaxY)
+	{
+		const double DX = FMath::Max3(MinX - P.X, 0.0, P.X - MaxX);
+		const double DY = FMath::Max3(MinY - P.Y, 0.0, P.Y - MaxY);
+		return DX * DX + DY * DY;
+	};
+
+	// Walk square rings of cells around P's (clamped) cell. Once a ring is done,
+	// every unvisited edge lies in the part of the grid beyond one of the ring's
+	// sides, so the closest of those regions bounds their distance. Points
+	// outside the grid start on its border and stop as soon as the ring reaches
+	// the hit, not after sweeping the whole grid.
+	for (int32 R = 0;; R++)
+	{
+		const int32 X0 = CX - R;
+		const int32 X1 = CX + R;
+		const int32 Y0 = CY - R;
+		const int32 Y1 = CY + R;
+
+		VisitRowSpan(Y0, X0, X1);
+		if (R > 0)
+		{
+			VisitRowSpan(Y1, X0, X1);
+			for (int32 Y = Y0 + 1; Y < Y1; Y++)
+			{
+				VisitRowSpan(Y, X0, X0);
+				VisitRowSpan(Y, X1, X1);
+			}
+		}
+
+		bool bUnvisited = false;
+		double LowerBoundSq = TNumericLimits<double>::Max();
+		if (X0 > 0)
+		{
+			bUnvisited = true;
+			LowerBoundSq = FMath::Min(LowerBoundSq, DistSquaredToRegion(GridOrigin.X, GridOrigin.Y, GridOrigin.X + X0 * GridCellSize, GridMax.Y));
+		}
+		if (X1 < GridCellsX - 1)
+		{
+			bUnvisited = true;
+			LowerBoundSq = FMath::Min(LowerBoundSq, DistSquaredToRegion(GridOrigin.X + (X1 + 1) * GridCellSize, GridOrigin.Y, GridMax.X, GridMax.Y));
+		}
+		if (Y0 > 0)
+		{
+			bUnvisited = true;
+			LowerBoundSq = FMath::Min(LowerBoundSq, DistSquaredToRegion(GridOrigin.X, GridOrigin.Y, GridMax.X, GridOrigin.Y + Y0 * GridCellSize));
+		}
+		if (Y1 < GridCellsY - 1)
+		{
+			bUnvisited = true;
+			LowerBoundSq = FMath::Min(LowerBoundSq, DistSquaredToRegion(GridOrigin.X, GridOrigin.Y + (Y1 + 1) * GridCellSize, GridMax.X, GridMax.Y));
+		}
+
+		if (!bUnvisited || MinDistSq <= LowerBoundSq)
+		{
+			break;
+		}
+	}
+
+	return MinDistSq;
 }
 
 int32 FPCGExSpatialDomain_Polygon2D::Append(const FPCGExFootprintShape& Shape, int32 OwnerIndex, uint32 ChannelMask)
@@ -65,4 +210,133 @@ void FPCGExSpatialDomain_Polygon2D::RecomputeBounds()
 
 	WorldBounds = PCGExMath::Geo::ProjectPrismToWorldAABB(
 		Outline, ZMin, ZMax, FVector::ZeroVector, ProjectionQuat);
+
+	BuildEdgeGrid();
+}
+
+void FPCGExSpatialDomain_Polygon2D::BuildEdgeGrid()
+{
+	GridCellsX = 0;
+	GridCellsY = 0;
+	CellStarts.Empty();
+	CellEdges.Empty();
+	RowStarts.Empty();
+	RowEdges.Empty();
+
+	const int32 N = Outline.Num();
+	if (N < EdgeGridMinEdges || !Bounds2D.bIsValid)
+	{
+		return;
+	}
+
+	// Square cells sized for ~1 edge per cell; flat outlines fall back on their extent.
+	const FVector2D Size = Bounds2D.GetSize();
+	const double Area = Size.X * Size.Y;
+	double CellSize = Area > UE_SMALL_NUMBER ? FMath::Sqrt(Area / N) : FMath::Max(Size.X, Size.Y) / N;
+	CellSize = FMath::Max3(CellSize, Size.X / PCGExSpatialDomainPolygon2D::MaxGridCellsPerAxis, Size.Y / PCGExSpatialDomainPolygon2D::MaxGridCellsPerAxis);
+	if (CellSize <= UE_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	GridOrigin = Bounds2D.Min;
+	GridCellSize = CellSize;
+	GridInvCellSize = 1.0 / CellSize;
+	GridCellsX = FMath::Clamp(FMath::CeilToInt32(Size.X * GridInvCellSize), 1, PCGExSpatialDomainPolygon2D::MaxGridCellsPerAxis);
+	GridCellsY = FMath::Clamp(FMath::CeilToInt32(Size.Y * GridInvCellSize), 1, PCGExSpatialDomainPolygon2D::MaxGridCellsPerAxis);
+
+	// Cells crossed by an edge, row by row: the edge is clipped to each row band
+	// (padded, so float noise can't drop a cell it actually touches) and the
+	// resulting X span is rasterized. Conservative, never misses a cell.
+	const double Pad = GridCellSize * 1e-3;
+	auto ForEachEdgeCell = [&](const int32 Edge, auto&& Fn)
+	{
+		const FVector2D& A = Outline[Edge];
+		const FVector2D& B = Outline[Edge + 1 == N ? 0 : Edge + 1];
+		const int32 Y0 = GetCellY(FMath::Min(A.Y, B.Y) - Pad);
+		const int32 Y1 = GetCellY(FMath::Max(A.Y, B.Y) + Pad);
+		const double DY = B.Y - A.Y;
+
+		for (int32 Y = Y0; Y <= Y1; Y++)
+		{
+			double XMin = FMath::Min(A.X, B.X);
+			double XMax = FMath::Max(A.X, B.X);
+			if (Y0 != Y1 && FMath::Abs(DY) > UE_SMALL_NUMBER)
+			{
+				const double BandMin = GridOrigin.Y + Y * GridCellSize - Pad;
+				const double BandMax = GridOrigin.Y + (Y + 1) * GridCellSize + Pad;
+				const double T0 = FMath::Clamp((BandMin - A.Y) / DY, 0.0, 1.0);
+				const double T1 = FMath::Clamp((BandMax - A.Y) / DY, 0.0, 1.0);
+				const double XA = A.X + (B.X - A.X) * T0;
+				const double XB = A.X + (B.X - A.X) * T1;
+				XMin = FMath::Min(XA, XB);
+				XMax = FMath::Max(XA, XB);
+			}
+
+			const int32 X0 = GetCellX(XMin - Pad);
+			const int32 X1 = GetCellX(XMax + Pad);
+			for (int32 X = X0; X <= X1; X++)
+			{
+				Fn(Y * GridCellsX + X);
+			}
+		}
+	};
+
+	// Rows spanned by an edge, same floor as the query so the row lookup is exact.
+	auto GetEdgeRows = [&](const int32 Edge, int32& OutY0, int32& OutY1)
+	{
+		const double AY = Outline[Edge].Y;
+		const double BY = Outline[Edge + 1 == N ? 0 : Edge + 1].Y;
+		OutY0 = GetCellY(FMath::Min(AY, BY));
+		OutY1 = GetCellY(FMath::Max(AY, BY));
+	};
+
+	const int32 NumCells = GridCellsX * GridCellsY;
+
+	// Counting pass, then prefix sums, then fill -- two flat CSR arrays.
+	CellStarts.SetNumZeroed(NumCells + 1);
+	RowStarts.SetNumZeroed(GridCellsY + 1);
+	for (int32 Edge = 0; Edge < N; Edge++)
+	{
+		ForEachEdgeCell(Edge, [&](const int32 Cell)
+		{
+			CellStarts[Cell + 1]++;
+		});
+
+		int32 Y0, Y1;
+		GetEdgeRows(Edge, Y0, Y1);
+		for (int32 Y = Y0; Y <= Y1; Y++)
+		{
+			RowStarts[Y + 1]++;
+		}
+	}
+
+	for (int32 i = 0; i < NumCells; i++)
+	{
+		CellStarts[i + 1] += CellStarts[i];
+	}
+	for (int32 i = 0; i < GridCellsY; i++)
+	{
+		RowStarts[i + 1] += RowStarts[i];
+	}
+
+	CellEdges.SetNumUninitialized(CellStarts[NumCells]);
+	RowEdges.SetNumUninitialized(RowStarts[GridCellsY]);
+
+	TArray<int32> CellCursor(CellStarts.GetData(), NumCells);
+	TArray<int32> RowCursor(RowStarts.GetData(), GridCellsY);
+	for (int32 Edge = 0; Edge < N; Edge++)
+	{
+		ForEachEdgeCell(Edge, [&](const int32 Cell)
+		{
+			CellEdges[CellCursor[Cell]++] = Edge;
+		});
+
+		int32 Y0, Y1;
+		GetEdgeRows(Edge, Y0, Y1);
+		for (int32 Y = Y0; Y <= Y1; Y++)
+		{
+			RowEdges[RowCursor[Y]++] = Edge;
+		}
+	}
 }
@@ -49,6 +49,13 @@ public:
 	 */
 	virtual float QueryPoint(const FVector& Point) const = 0;
 
+	/**
+	 * Batched QueryPoint. OutDistances must be at least as large as Points.
+	 * Default loops QueryPoint; subclasses with per-query setup (frame
+	 * transforms, index lookups) override to amortize it over the batch.
+	 */
+	virtual void QueryPoints(TConstArrayView<FVector> Points, TArrayView<float> OutDistances) const;
+
 	/**
 	 * Conservative OBB query -- samples center + 8 corners (9 points).
 	 * Returns minimum signed distance across all samples ("most inside").
@@ -34,9 +34,12 @@ namespace PCGExPaths
  * explicit projection.
  *
  * Topology: arbitrary (concave allowed). Inside test delegates to
- * winding-number math. Closest-edge distance is naive O(N) -- fine for
- * typical room outlines (10-50 edges); add an edge octree later if
- * profiling justifies.
+ * winding-number math. Small outlines (typical rooms, < EdgeGridMinEdges)
+ * go through the plain O(N) pass; larger ones (site perimeters, traced
+ * coastlines) bake a uniform edge grid at construction: the winding test
+ * only visits edges spanning the query row, and the closest-edge search
+ * walks cell rings outward until no unvisited cell can beat the best hit.
+ * Both are exact -- results match the O(N) pass.
  *
  * Signed distance follows the unified convention (negative inside).
  *
@@ -79,6 +82,7 @@ public:
 	// ========== FPCGExSpatialDomain ==========
 
 	virtual float QueryPoint(const FVector& Point) const override;
+	virtual void QueryPoints(TConstArrayView<FVector> Points, TArrayView<float> OutDistances) const override;
 
 	virtual FBox GetBounds() const override
 	{
@@ -114,6 +118,9 @@ public:
 		return ZMax;
 	}
 
+	/** Outlines with at least this many edges get an edge grid. */
+	static constexpr int32 EdgeGridMinEdges = 32;
+
 private:
 	/** Authored 2D outline in projection-frame XY. Winding-agnostic for inside test. */
 	TArray<FVector2D> Outline;
@@ -140,6 +147,49 @@ private:
 	 */
 	FBox WorldBounds = FBox(ForceInit);
 
-	/** Recompute Bounds2D + WorldBounds from Outline + (ZMin, ZMax) + ProjectionQuat. */
+	/**
+	 * Uniform grid over Bounds2D, ~1 edge per cell. Edge i runs from
+	 * Outline[i] to Outline[(i + 1) % N]. Empty when the outline is below
+	 * EdgeGridMinEdges.
+	 *
+	 * CellStarts/CellEdges: CSR list of the edges crossing each cell
+	 * (cell = Y * GridCellsX + X), used by the closest-edge ring search.
+	 * RowStarts/RowEdges: CSR list of the edges whose Y span overlaps each
+	 * grid row, used by the winding test.
+	 */
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+	double GridCellSize = 0.0;
+	double GridInvCellSize = 0.0;
+	int32 GridCellsX = 0;
+	int32 GridCellsY = 0;
+	TArray<int32> CellStarts;
+	TArray<int32> CellEdges;
+	TArray<int32> RowStarts;
+	TArray<int32> RowEdges;
+
+	bool HasEdgeGrid() const
+	{
+		return GridCellsX > 0;
+	}
+
+	/** Recompute Bounds2D + WorldBounds from Outline + (ZMin, ZMax) + ProjectionQuat, and rebuild the edge grid. */
 	void RecomputeBounds();
+
+	void BuildEdgeGrid();
+
+	/** QueryPoint, with Point already in projection-frame space. */
+	float QueryLocalPoint(const FVector& LocalPoint) const;
+
+	bool IsInside2D(const FVector2D& P) const;
+	float ClosestEdgeDistSquared(const FVector2D& P) const;
+
+	int32 GetCellX(double X) const
+	{
+		return FMath::Clamp(FMath::FloorToInt32((X - GridOrigin.X) * GridInvCellSize), 0, GridCellsX - 1);
+	}
+
+	int32 GetCellY(double Y) const
+	{
+		return FMath::Clamp(FMath::FloorToInt32((Y - GridOrigin.Y) * GridInvCellSize), 0, GridCellsY - 1);
+	}
 };